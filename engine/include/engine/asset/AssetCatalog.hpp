@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -8,11 +12,12 @@
 #include "engine/asset/AssetError.hpp"
 #include "engine/asset/AssetId.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/asset/catalog/CatalogDiff.hpp"
 #include "engine/asset/catalog/CatalogEntry.hpp"
 #include "engine/base/Error.hpp"
 
 namespace Engine::Asset::Catalog {
-    struct RawCatalogEntry;
+    struct RawCatalogEntryView;
     class CatalogParser;
 }
 
@@ -20,34 +25,105 @@ namespace Engine::Asset::Resolver {
     class AssetPathResolver;
 }
 
+namespace Engine::Asset::Detail {
+    class FileMapping;
+}
+
 namespace Engine::Asset {
 
     using AssetError = Base::Error<AssetErrorCode>;
 
     class AssetCatalog final {
+    public:
+        struct Options final {
+            // JSON catalog の構築（path 解決・entry 作成）に使うスレッド数
+            // 0 なら std::thread::hardware_concurrency()。1 なら従来どおり呼び出したスレッドだけで行う
+            std::uint32_t buildThreads = 0;
+
+            // 1 スレッドあたりの最小 entry 数（これより少ない catalog はスレッドを減らす / 立てない）
+            std::uint32_t minEntriesPerBuildThread = 1024;
+        };
+
     public:
         AssetCatalog() = default;
+        explicit AssetCatalog(Options opt) : opt_(opt) {}
+
+        void SetOptions(Options opt) noexcept { opt_ = opt; }
+        const Options& GetOptions() const noexcept { return opt_; }
 
         void Clear();
 
         // resolvedPath込みで構築する
+        // - path 解決と entry 作成は Options::buildThreads 本に分けて並列に行い、登録だけ catalog の順に直列で行う
+        // - なのでエラー（重複 id / 不正 path など）はスレッド数によらず、catalog の先頭から見て最初の 1 件になる
         Base::Result<void, AssetError>
         LoadFromFile(std::string_view catalogJsonPath,
                      Catalog::CatalogParser& parser,
                      const Resolver::AssetPathResolver& resolver);
 
-        const Catalog::CatalogEntry* Find(const AssetId& id) const noexcept;
+        // catalog.json を読み直し、今の内容との差分だけを反映する（Clear しない）
+        // - 変わらなかった entry はそのまま（Find で得たポインタも有効なまま）
+        // - 読み込み / 構築に失敗したら今の内容は変えない
+        // - バイナリ catalog を使っている場合は、差分を取ったうえで JSON の内容に切り替える
+        Base::Result<Catalog::CatalogDiff, AssetError>
+        ReloadFromFile(std::string_view catalogJsonPath,
+                       Catalog::CatalogParser& parser,
+                       const Resolver::AssetPathResolver& resolver);
+
+        // バイナリ catalog（CatalogCompiler の出力）を mmap して使う
+        // - parse / resolve をしない（resolvedPath はコンパイル時に解決済み）
+        // - FindView は mmap 領域を直接指すので確保無し
+        Base::Result<void, AssetError>
+        LoadCompiled(std::string_view compiledCatalogPath);
+
+        bool IsCompiled() const noexcept { return compiled_ != nullptr; }
 
-        // 任意：watch登録したい場合などに全件列挙
+        std::size_t Size() const noexcept;
+
+        // バイナリ catalog では引いた entry をその都度 CatalogEntry に写して保持する（確保あり）
+        // - そのため noexcept ではない（確保 / lock の失敗は例外で上がる）
+        // 毎フレーム引くなら FindView を使う
+        const Catalog::CatalogEntry* Find(const AssetId& id) const;
+
+        // 確保せずに引く（JSON / バイナリどちらでも）。見つからなければ false
+        bool FindView(const AssetId& id, Catalog::CatalogEntryView& out) const noexcept;
+
+        // 任意：watch登録したい場合などに全件列挙（バイナリ catalog では Find と同じく全件を写す）
         std::vector<const Catalog::CatalogEntry*> Entries() const;
 
     private:
+        using EntryMap = std::unordered_map<AssetId, Catalog::CatalogEntry>;
+
         Base::Result<void, AssetError>
-        BuildFromRaw_(const std::vector<Catalog::RawCatalogEntry>& raw,
-                      const Resolver::AssetPathResolver& resolver);
+        BuildFromFile_(std::string_view catalogJsonPath,
+                       Catalog::CatalogParser& parser,
+                       const Resolver::AssetPathResolver& resolver,
+                       EntryMap& out) const;
+
+        Base::Result<void, AssetError>
+        BuildFromRaw_(const std::vector<Catalog::RawCatalogEntryView>& raw,
+                      const Resolver::AssetPathResolver& resolver,
+                      EntryMap& out) const;
+
+        bool FindCompiled_(const AssetId& id, Catalog::CatalogEntryView& out) const noexcept;
+        const Catalog::CatalogEntry* Materialize_(const Catalog::CatalogEntryView& v) const;
 
     private:
-        std::unordered_map<AssetId, Catalog::CatalogEntry> map_;
+        Options opt_{};
+
+        // JSON から構築した entry（バイナリ catalog では Find / Entries で写したもの）
+        mutable EntryMap map_;
+        mutable std::mutex materializeMutex_; // バイナリ catalog の map_ 用
+
+        // バイナリ catalog
+        std::shared_ptr<const Detail::FileMapping> compiled_;
+        const std::byte* seeds_ = nullptr;
+        const std::byte* entries_ = nullptr;
+        const char* strings_ = nullptr;
+        std::uint64_t stringsSize_ = 0;
+        std::uint64_t salt_ = 0;
+        std::uint32_t entryCount_ = 0;
+        std::uint32_t bucketCount_ = 0;
     };
 
 } // namespace Engine::Asset
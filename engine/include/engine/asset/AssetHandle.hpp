@@ -13,28 +13,34 @@ namespace Engine::Asset {
 // - ゲーム側や上位層に渡す「トークン（ID + 世代 + 型）」
 // - 実体（shared_ptr等）を直接持たない（= エンジン内部のキャッシュに依存しない）
 // - AssetManager がこのハンドルを受け取って AssetStorage/Record を参照する
+// - slot は AssetStorage 内の record の位置（分かれば AssetManager はハッシュ引き無しで record に届く）
 class AssetHandle final {
 public:
+    // slot 未指定（AssetId から引く）
+    static constexpr std::uint32_t kNoSlot = 0xFFFFFFFFu;
+
     AssetHandle() = default;
 
     // 無効ハンドル（generation==0 を無効扱いにする：AssetId の仕様に依存しない）
     static AssetHandle Invalid() noexcept { return AssetHandle{}; }
 
     // 型を指定しない（デフォルト）
-    static AssetHandle Make(AssetId id, std::uint32_t generation) noexcept {
+    static AssetHandle Make(AssetId id, std::uint32_t generation, std::uint32_t slot = kNoSlot) noexcept {
         AssetHandle h;
         h.id_ = std::move(id);
         h.generation_ = generation;
+        h.slot_ = slot;
         h.type_ = Detail::TypeId{}; // unknown
         return h;
     }
 
     // 型を指定する（デバッグ/安全性用）
     template <class T>
-    static AssetHandle MakeTyped(AssetId id, std::uint32_t generation) noexcept {
+    static AssetHandle MakeTyped(AssetId id, std::uint32_t generation, std::uint32_t slot = kNoSlot) noexcept {
         AssetHandle h;
         h.id_ = std::move(id);
         h.generation_ = generation;
+        h.slot_ = slot;
         h.type_ = Detail::TypeId::Of<T>();
         return h;
     }
@@ -46,6 +52,8 @@ public:
 
     const AssetId& id() const noexcept { return id_; }
     std::uint32_t generation() const noexcept { return generation_; }
+    std::uint32_t slot() const noexcept { return slot_; }
+    bool has_slot() const noexcept { return slot_ != kNoSlot; }
 
     // 型ヒント：未指定なら invalid(TypeId{}) になる
     Detail::TypeId type_hint() const noexcept { return type_; }
@@ -72,6 +80,7 @@ public:
 private:
     AssetId id_{};
     std::uint32_t generation_ = 0;
+    std::uint32_t slot_ = kNoSlot;
     Detail::TypeId type_{};
 };
 
@@ -2,29 +2,32 @@
 
 #include <cstdint>
 #include <cstddef>
-#include <string>
 #include <string_view>
 #include <functional>
+#include <type_traits>
 #include "detail/Hash.hpp"
+#include "detail/NameTable.hpp"
 
 namespace Engine::Asset {
 
 /// AssetId：カタログ上の "id" をエンジン内部で扱いやすいIDにしたもの
-/// - 文字列ID -> 64-bit hash
-/// - ENGINE_ASSET_DEBUG_NAME=1 の場合は debugName も保持（衝突調査が容易）
+/// - 文字列ID -> 64-bit hash（8 byte の値型。コピー・比較はハッシュ値だけ）
+/// - 元の文字列は Detail::AssetIdNames() に intern する（DebugName で引ける）
+///   - ENGINE_ASSET_DEBUG_NAME=1 なら FromString でも登録する
+///   - ハッシュ衝突の検出は AssetCatalog の構築時に 1 回だけ行う
 struct AssetId final {
     using ValueType = uint64_t;
 
     ValueType value{0};
 
-    std::string debugName; // 元のID文字列（例: "player_tex"）
-
     constexpr AssetId() noexcept = default;
     explicit constexpr AssetId(ValueType v) noexcept : value(v) {}
 
     static AssetId FromString(std::string_view s) noexcept {
         AssetId id{ Detail::Fnv1a64(s) };
-        id.debugName = std::string(s);
+#if ENGINE_ASSET_DEBUG_NAME
+        Detail::AssetIdNames().Intern(id.value, s);
+#endif
         return id;
     }
 
@@ -33,21 +36,34 @@ struct AssetId final {
     // 便利：文字列を直接渡せる
     explicit AssetId(std::string_view s) noexcept : AssetId(FromString(s)) {}
 
-    friend bool operator==(const AssetId& a, const AssetId& b) noexcept {
-        // 両方に名前があるなら名前優先（ハッシュ衝突の検出に役立つ）
-        if (!a.debugName.empty() && !b.debugName.empty()) {
-            return a.debugName == b.debugName;
-        }
-        return a.value == b.value;
-    }
+    // 元の文字列（登録されていなければ空）：ログ / エラー表示用。ホットパスでは使わない
+    std::string_view DebugName() const { return Detail::AssetIdNames().Find(value); }
 
-    friend bool operator!=(const AssetId& a, const AssetId& b) noexcept { return !(a == b); }
+    friend constexpr bool operator==(const AssetId& a, const AssetId& b) noexcept { return a.value == b.value; }
+    friend constexpr bool operator!=(const AssetId& a, const AssetId& b) noexcept { return !(a == b); }
 
-    friend bool operator<(const AssetId& a, const AssetId& b) noexcept {
+    friend constexpr bool operator<(const AssetId& a, const AssetId& b) noexcept {
         return a.value < b.value;
     }
 };
 
+static_assert(sizeof(AssetId) == 8 && std::is_trivially_copyable_v<AssetId>);
+
+inline namespace Literals {
+
+    // "player_tex"_aid：コンパイル時にハッシュ化した AssetId（FromString と同じ値）
+    // - 実行時のハッシュ計算・確保が無いので、毎フレーム引く固定 id はこちらを使う
+    // - 名前は ENGINE_ASSET_DEBUG_NAME=1 のとき静的初期化で NameTable に登録される
+    template <Detail::FixedString S>
+    consteval AssetId operator""_aid() noexcept {
+#if ENGINE_ASSET_DEBUG_NAME
+        (void)Detail::LiteralName<&Detail::AssetIdNames, S>::registered;
+#endif
+        return AssetId{ Detail::Fnv1a64(S.View()) };
+    }
+
+} // namespace Literals
+
 } // namespace Engine::Asset
 
 // unordered_map 用
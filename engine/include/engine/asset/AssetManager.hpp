@@ -1,9 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <deque>
+#include <memory>
 #include <string>
-#include <unordered_set>
+#include <unordered_map>
 #include <vector>
 
 #include "engine/asset/AssetError.hpp"
@@ -12,15 +13,22 @@
 #include "engine/asset/AssetRequest.hpp"
 #include "engine/asset/AssetState.hpp"
 #include "engine/asset/AssetType.hpp"
+#include "engine/asset/catalog/CatalogDiff.hpp"
 
 #include "engine/asset/core/AssetCachePolicy.hpp"
+#include "engine/asset/core/AssetGraveyard.hpp"
 #include "engine/asset/core/AssetLifetime.hpp"
 #include "engine/asset/core/AssetStatistics.hpp"
 #include "engine/asset/core/AssetStorage.hpp"
+#include "engine/asset/core/EvictionSimulator.hpp"
+#include "engine/asset/core/EvictionStrategy.hpp"
 
 #include "engine/base/Result.hpp"
 #include "engine/asset/loading/AssetPipeline.hpp"
+#include "engine/asset/loading/AssetWorkerPool.hpp"
+#include "engine/asset/loading/LoadCostModel.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
+#include "engine/asset/loading/LoadScheduler.hpp"
 
 #include "engine/asset/hot_reload/AssetWatcher.hpp"
 
@@ -36,13 +44,44 @@ namespace Engine::Asset {
     public:
         struct Options final {
             // Asyncキューを1フレームに何件処理するか（擬似async / ポーリング）
+            // workerThreads > 0 の場合は使わない（maxInFlightLoads が上限になる）
             std::uint32_t maxLoadsPerFrame = 2;
 
+            // 1フレームでロード/publish に使って良い時間（マイクロ秒）
+            // 0 なら maxLoadsPerFrame（件数）で制御する。
+            // 0 以外なら件数ではなく時間で止める：次の1件の見積もり（LoadCostModel）が予算を超えるなら次フレームへ。
+            // ※ 毎フレーム最低1件は進める（見積もりが大きすぎて永久に詰まるのを防ぐ）
+            std::uint64_t frameBudgetUs = 0;
+
+            // Async ロードを実行する worker thread 数
+            // 0 なら従来どおり Update() 内（main thread）で同期実行する
+            std::uint32_t workerThreads = 0;
+
+            // worker へ同時に投げておく最大件数（キューから先取りしすぎない）
+            std::uint32_t maxInFlightLoads = 16;
+
+            // 1 回の Dispatch で取り出した job を何件ずつまとめて worker へ渡すか
+            // まとめた分は IAssetSource::ReadMany の 1 バッチになる（io_uring 等で queue depth が稼げる）
+            // 1 なら従来どおり 1 件ずつ。バッチは worker 数に均等割りするので decode の並列度は落ちない
+            std::uint32_t ioBatchSize = 32;
+
+            // Async キューの aging：この フレーム数待つごとに実効 priority +1（0 なら aging 無し）
+            std::uint64_t priorityAgingFrames = 60;
+
             // HotReload を AssetManager 側で Poll して Reload を投げるか
             bool enableHotReload = false;
 
             // Reload するときは基本 KeepOldIfAny にする（開発中のUX優先）
             bool reloadKeepOldIfAny = true;
+
+            // evict した asset の破棄を background thread（Core::AssetGraveyard）でまとめて行う
+            // false なら従来どおり BeginFrame（AssetStorage::ReclaimRetired）の中で破棄する
+            bool deferDestruction = false;
+            Core::AssetGraveyard::Options graveyard{};
+
+            // ※ record 数の上限はここではなく、注入する AssetStorage の Options::maxRecords（既定 1Mi）で決まる
+            //   evict した record の slot も次の BeginFrame（ReclaimRetired）までは上限に数える
+            //   上限に届くと Load は InternalError、Async の job はロードせずに捨てる
         };
 
         // 依存は参照で注入：Engine内の “組み立て” は EngineCore/Services の責務
@@ -53,16 +92,44 @@ namespace Engine::Asset {
                      Core::AssetCachePolicy& cachePolicy,
                      Core::AssetStatistics* stats = nullptr,
                      HotReload::AssetWatcher* watcher = nullptr);
+        ~AssetManager();
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
 
         void SetOptions(Options opt);
         const Options& GetOptions() const noexcept;
 
         // フレーム境界（寿命/統計/ホットリロードのため）
+        // AssetStorage の退役 record もここで解放する（他スレッドが record を参照していないこと）
+        // deferDestruction なら asset の破棄は graveyard の thread へ回す
         void BeginFrame(std::uint64_t frameIndex);
 
         // 1フレーム処理：asyncキュー消化 + (任意) hot-reload poll
+        // - worker 利用時は、完了したロード結果をここで AssetRecord へ publish する（同期点）
+        // - Budgeted なら、参照の無い asset を古い順に evict して maxAssets / 常駐バイト上限（合計・type 別）に収める
         void Update();
 
+        // worker へ投げたロードがすべて完了するまで待ち、結果を publish する（ロード画面/終了処理用）
+        void WaitForAsyncLoads();
+
+        // 常駐バイト数（IAssetLoader::ResidentBytes の合計。Budgeted の byte budget はこれで判定する）
+        std::uint64_t GetResidentBytes() const noexcept { return residentBytes_; }
+        std::uint64_t GetResidentBytes(AssetType type) const noexcept {
+            auto it = residentBytesByType_.find(type);
+            return (it == residentBytesByType_.end()) ? 0 : it->second;
+        }
+
+        // アクセス列の記録先（nullptr で止める）：cache hit / Acquire / ロード完了のたびに 1 件足す
+        // - Core::EvictionSimulator に流して置換アルゴリズムを比べる用
+        void SetAccessTrace(std::vector<Core::EvictionTraceEvent>* trace) noexcept { trace_ = trace; }
+
+        // deferDestruction のときの graveyard（無効なら nullptr）
+        Core::AssetGraveyard* GetGraveyard() noexcept { return graveyard_.get(); }
+
+        // 時間予算で使うロードコストの学習結果（デバッグ表示用）
+        const Loading::LoadCostModel& GetCostModel() const noexcept { return costModel_; }
+
         // ---- Public API ----
 
         // Load:
@@ -102,19 +169,21 @@ namespace Engine::Asset {
             return std::const_pointer_cast<const T>(sp);
         }
 
-        // 低レベル：evict を “1つだけ” 試す（Budgeted運用などで上位がループする想定）
+        // 低レベル：evict を “1つだけ” 試す（Budgeted の自動 trim とは別に、上位が任意のタイミングで消したいとき用）
         bool EvictIfPossible(const AssetId& id);
 
+        // catalog を差分リロードした後に呼ぶ（AssetCatalog::ReloadFromFile の結果を渡す）
+        // - changed：record があれば type / resolvedPath を差し替え、読み込み済み（Ready / Loading / Failed）なら
+        //   hot-reload と同じ ForceReload を Async で積む。watch 中なら新しい path で張り直す
+        // - removed：watch を外すだけ（record と読み込み済みデータはそのまま。次の Load は CatalogNotFound）
+        // - added：何もしない（次の Load で普通に読まれる）
+        // 戻り値：reload を積んだ件数
+        std::size_t ApplyCatalogDiff(const Catalog::CatalogDiff& diff);
+
         // HotReload 用：外部から watch 登録したい場合
         void Watch(const AssetId& id, std::string resolvedPath);
         void Unwatch(const AssetId& id);
 
-    private:
-        struct PendingLoad final {
-            AssetId id;
-            AssetRequest req;
-        };
-
     private:
         // ---- internal helpers ----
         struct ResolvedEntry final {
@@ -125,18 +194,58 @@ namespace Engine::Asset {
         // AssetCatalog から (type, resolvedPath) を引く
         Base::Result<ResolvedEntry, AssetError> ResolveEntry_(const AssetId& id, const AssetRequest& req);
 
-        // Record 取得/作成
-        Core::AssetRecord& GetOrCreateRecord_(const AssetId& id, const ResolvedEntry& e);
+        // Record 取得/作成（AssetStorage の上限に届いていれば nullptr）
+        Core::AssetRecord* GetOrCreateRecord_(const AssetId& id, const ResolvedEntry& e);
 
         // 実ロード（Sync）
-        Base::Result<void, AssetError> DoLoadSync_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req);
+        Base::Result<void, AssetError> DoLoadSync_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req,
+                                                   Loading::LoadReport* report = nullptr);
+
+        // ロード結果を record に反映する（Sync / worker 完了の共通処理）
+        Base::Result<void, AssetError> CommitLoadResult_(Core::AssetRecord& rec,
+                                                         const std::string& resolvedPath,
+                                                         const AssetRequest& req,
+                                                         bool wasReady,
+                                                         Base::Result<Core::AnyAsset, AssetError> r,
+                                                         const Loading::LoadReport& report);
+
+        // rec.residentBytes を差し替え、合計 / type 別の集計を合わせる
+        void SetResidentBytes_(Core::AssetRecord& rec, std::uint64_t bytes);
+        // evict 時：集計からだけ外す（rec.residentBytes は graveyard の上限判定に使うので残す）
+        void ForgetResidentBytes_(const Core::AssetRecord& rec);
+
+        Loading::LoadContext MakeContext_(const Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest* req) const;
 
         // Async キュー操作
         void EnqueueLoad_(const AssetId& id, const AssetRequest& req);
         void ProcessQueue_();
 
+        // worker 経由の Async
+        void RebuildWorkers_();
+        void DispatchToWorkers_();
+        // budgetNs == 0 なら全件 publish する
+        void PublishCompleted_(std::uint64_t budgetNs = 0);
+
+        // 時間予算：id の次回ロードにかかりそうな時間（AssetStatistics の lastBytesRead から推定）
+        std::uint64_t EstimateLoadNs_(const AssetId& id) const;
+
+        // Budgeted：置換アルゴリズムの順（既定は参照が切れた順）で、数 / 常駐バイト（合計・type 別）の上限に収まるまで evict する
+        // （戻り値は evict した数）
+        std::size_t TrimToBudget_();
+
+        // 置換アルゴリズムへの通知（trace の記録もここ）
+        // - policy の eviction が Lru 以外なら evictor_ を持つ（切り替わったら作り直し、以後のアクセスで埋め直す）
+        void SyncEvictor_();
+        void NoteAccess_(const Core::AssetRecord& rec);
+        void NoteLoaded_(const Core::AssetRecord& rec);
+        void NoteRemoved_(const AssetId& id);
+
+        // refCount++（0 → 1 なら LRU から外す）
+        void AddRef_(Core::AssetRecord& rec);
+
         // Hot reload
         void ProcessHotReload_();
+        void EnqueueReload_(const AssetId& id);
 
         // Record検索（staleチェックは呼び出し側）
         Core::AssetRecord* FindRecord_(const AssetHandle& h);
@@ -154,8 +263,27 @@ namespace Engine::Asset {
         Options opt_{};
         std::uint64_t frame_ = 0;
 
-        std::deque<PendingLoad> queue_;
-        std::unordered_set<AssetId> queued_; // 重複防止
+        // Async 待ち（priority 順 / 同一 id はマージ）
+        Loading::LoadScheduler queue_;
+
+        // worker 実行中の id -> 投入時に Ready だったか（KeepOldIfAny 判定用）
+        std::unordered_map<AssetId, bool> inFlight_;
+        std::vector<Loading::AssetWorkerPool::Completion> completed_; // 予算切れで次フレームへ持ち越す分を含む
+        Loading::LoadCostModel costModel_{};
+        std::unique_ptr<Loading::AssetWorkerPool> workers_;
+        std::unique_ptr<Core::AssetGraveyard> graveyard_; // Options::deferDestruction のときだけ
+
+        // 常駐バイト数の集計（record の residentBytes の合計）
+        std::uint64_t residentBytes_ = 0;
+        std::unordered_map<AssetType, std::uint64_t> residentBytesByType_;
+
+        // Lfu / Arc / Gdsf のときだけ持つ（Lru は lifetime_ の LRU リストを使う）
+        std::unique_ptr<Core::IEvictionStrategy> evictor_;
+        std::vector<Core::EvictionTraceEvent>* trace_ = nullptr;
+
+        // TrimToBudget_ の作業用（毎フレーム確保しない）
+        std::vector<AssetId> trimVictims_;
+        std::unordered_map<AssetType, std::uint64_t> trimTypeExcess_;
     };
 
 } // namespace Engine::Asset
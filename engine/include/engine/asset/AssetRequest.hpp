@@ -54,7 +54,7 @@ struct AssetRequest final {
 
     // cache/policy hint（任意）
     // - pin: 強制保持したい場合（AssetLifetime.Pin と連動させる）
-    // - keepAliveFrames: この要求だけTTLを上書きしたい場合（0=デフォルト運用）
+    // - keepAliveFramesOverride: この asset のTTLを上書きしたい場合（0=policy の type 別 / 既定値。evict まで有効）
     bool pin = false;
     std::uint64_t keepAliveFramesOverride = 0;
 
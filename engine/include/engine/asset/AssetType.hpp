@@ -3,23 +3,23 @@
 
 #include <cstdint>
 #include <cstddef>
-#include <string>
 #include <string_view>
 #include <functional>
+#include <type_traits>
 #include "detail/Hash.hpp"
+#include "detail/NameTable.hpp"
 
 namespace Engine::Asset {
 
 /// AssetType：アセットの種別（"texture", "sound" など）
-/// - 文字列 -> 64-bit hash
+/// - 文字列 -> 64-bit hash（8 byte の値型。比較はハッシュ値だけ）
 /// - エンジンが知らない type でも表現できる（ImporterRegistry 等で使える）
+/// - 元の文字列は Detail::AssetTypeNames() に intern する（AssetId と同じ扱い）
 struct AssetType final {
     using ValueType = uint64_t;
 
     ValueType value{0};
 
-    std::string debugName; // 元のtype文字列（例: "texture"）
-
 
     constexpr AssetType() noexcept = default;
     explicit constexpr AssetType(ValueType v) noexcept : value(v) {}
@@ -28,9 +28,9 @@ struct AssetType final {
 
     static AssetType FromString(std::string_view s) noexcept {
         AssetType t{ Detail::Fnv1a64(s) };
-
-        t.debugName = std::string(s);
-
+#if ENGINE_ASSET_DEBUG_NAME
+        Detail::AssetTypeNames().Intern(t.value, s);
+#endif
         return t;
     }
 
@@ -39,29 +39,43 @@ struct AssetType final {
     // 文字列を直接渡せる
     explicit AssetType(std::string_view s) noexcept : AssetType(FromString(s)) {}
 
+    // 元の文字列（登録されていなければ空）
+    std::string_view DebugName() const { return Detail::AssetTypeNames().Find(value); }
+
     // よく使うエンジン標準タイプ（必要に応じて追加）
-    static constexpr AssetType Texture() noexcept { return AssetType(Detail::Fnv1a64("texture", 7)); }
-    static constexpr AssetType Sound()   noexcept { return AssetType(Detail::Fnv1a64("sound",   5)); }
-    static constexpr AssetType Font()    noexcept { return AssetType(Detail::Fnv1a64("font",    4)); }
-    static constexpr AssetType Text()    noexcept { return AssetType(Detail::Fnv1a64("text",    4)); }
-    static constexpr AssetType Binary()  noexcept { return AssetType(Detail::Fnv1a64("binary",  6)); }
-    static constexpr AssetType Data()  noexcept { return AssetType(Detail::Fnv1a64("data",  4)); }
-    static constexpr AssetType Invalid() noexcept { return AssetType(Detail::Fnv1a64("invalid", 0)); }
-
-    friend bool operator==(const AssetType& a, const AssetType& b) noexcept {
-        if (!a.debugName.empty() && !b.debugName.empty()) {
-            return a.debugName == b.debugName;
-        }
-        return a.value == b.value;
-    }
+    static constexpr AssetType Texture() noexcept { return AssetType(Detail::Fnv1a64("texture")); }
+    static constexpr AssetType Sound()   noexcept { return AssetType(Detail::Fnv1a64("sound")); }
+    static constexpr AssetType Font()    noexcept { return AssetType(Detail::Fnv1a64("font")); }
+    static constexpr AssetType Text()    noexcept { return AssetType(Detail::Fnv1a64("text")); }
+    static constexpr AssetType Binary()  noexcept { return AssetType(Detail::Fnv1a64("binary")); }
+    static constexpr AssetType Data()  noexcept { return AssetType(Detail::Fnv1a64("data")); }
+    static constexpr AssetType Invalid() noexcept { return AssetType(Detail::Fnv1a64(std::string_view{})); }
 
-    friend bool operator!=(const AssetType& a, const AssetType& b) noexcept { return !(a == b); }
+    friend constexpr bool operator==(const AssetType& a, const AssetType& b) noexcept { return a.value == b.value; }
 
-    friend bool operator<(const AssetType& a, const AssetType& b) noexcept {
+    friend constexpr bool operator!=(const AssetType& a, const AssetType& b) noexcept { return !(a == b); }
+
+    friend constexpr bool operator<(const AssetType& a, const AssetType& b) noexcept {
         return a.value < b.value;
     }
 };
 
+static_assert(sizeof(AssetType) == 8 && std::is_trivially_copyable_v<AssetType>);
+
+inline namespace Literals {
+
+    // "texture"_atype：コンパイル時にハッシュ化した AssetType（FromString と同じ値）
+    // - loader の GetType など、固定の type はこちらを使う
+    template <Detail::FixedString S>
+    consteval AssetType operator""_atype() noexcept {
+#if ENGINE_ASSET_DEBUG_NAME
+        (void)Detail::LiteralName<&Detail::AssetTypeNames, S>::registered;
+#endif
+        return AssetType{ Detail::Fnv1a64(S.View()) };
+    }
+
+} // namespace Literals
+
 } // namespace Engine::Asset
 
 namespace std {
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/AssetType.hpp"
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/catalog/CatalogEntry.hpp"
+#include "engine/asset/loading/IAssetSource.hpp"
+
+namespace Engine::Asset {
+    class AssetCatalog;
+}
+
+namespace Engine::Asset::Catalog {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // CatalogCompiler：AssetCatalog（JSON から構築・resolve 済み）をバイナリ catalog にする
+    // - 形式は CompiledCatalogFormat.hpp。実行時は AssetCatalog::LoadCompiled で mmap して使う
+    // - tools/asset_packer（--compile-catalog）から使う
+    // - 同じ id の二重登録はエラー
+    class CatalogCompiler final {
+    public:
+        CatalogCompiler() = default;
+
+        Base::Result<void, AssetError> Add(const CatalogEntry& entry);
+        Base::Result<void, AssetError> AddCatalog(const AssetCatalog& catalog);
+
+        std::size_t EntryCount() const noexcept { return items_.size(); }
+
+        Base::Result<Loading::ByteBuffer, AssetError> Build() const;
+        Base::Result<void, AssetError> WriteToFile(std::string_view path) const;
+
+    private:
+        struct Item final {
+            AssetId::ValueType idKey = 0;
+            AssetType::ValueType typeKey = 0;
+            std::string sourcePath;
+            std::string resolvedPath;
+        };
+
+        std::vector<Item> items_;
+        std::unordered_set<std::uint64_t> idKeys_;
+    };
+
+} // namespace Engine::Asset::Catalog
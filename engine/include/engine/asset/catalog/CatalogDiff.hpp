@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+
+#include "engine/asset/AssetId.hpp"
+
+namespace Engine::Asset::Catalog {
+
+    // CatalogDiff：AssetCatalog::ReloadFromFile で読み直したときの差分（各 id は AssetId の値順）
+    // - changed は type か resolvedPath が変わったものだけ（sourcePath の書き方だけ変わっても含めない）
+    // - AssetManager::ApplyCatalogDiff に渡すと、changed のうち読み込み済みのものだけ reload する
+    struct CatalogDiff final {
+        std::vector<AssetId> added;
+        std::vector<AssetId> removed;
+        std::vector<AssetId> changed;
+
+        bool Empty() const noexcept { return added.empty() && removed.empty() && changed.empty(); }
+    };
+
+} // namespace Engine::Asset::Catalog
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "engine/asset/AssetId.hpp"
 #include "engine/asset/AssetType.hpp"
@@ -19,4 +20,14 @@ namespace Engine::Asset::Catalog {
         // uint64_t    fileSize = 0;
     };
 
+    // CatalogEntryView：確保せずに引くための参照（AssetCatalog::FindView）
+    // - 文字列は catalog 内（JSON なら CatalogEntry、バイナリなら mmap 領域）を指す
+    // - catalog を Clear / 再ロードするまで有効
+    struct CatalogEntryView final {
+        AssetId id{};
+        AssetType type{};
+        std::string_view sourcePath;
+        std::string_view resolvedPath;
+    };
+
 } // namespace Engine::Asset::Catalog
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -17,11 +18,31 @@ namespace Engine::Asset::Catalog {
         std::string path;  // sourcePath（相対想定）
     };
 
+    // RawCatalogEntryView：ParseViews の結果（コピー無し）
+    // - 文字列は catalogText を直接指す。エスケープを含む文字列だけ parser 内に復元してそちらを指す
+    // - catalogText と parser が生きていて、次の Parse / ParseViews を呼ぶまで有効
+    struct RawCatalogEntryView final {
+        std::string_view id;
+        std::string_view type;
+        std::string_view path;
+    };
+
+    // CatalogParser：catalog.json を読む（キー名は CatalogFormat）
+    // - DOM を作らず、先頭から 1 回なめながら entry を直接組み立てる
+    // - assets は array-form / object-form（id が key）のどちらも受け付ける
+    // - 未知のキーは読み飛ばす。version があれば CatalogFormat::IsSupportedVersion で確かめる
     class CatalogParser final {
     public:
         // catalogText: JSON全文
         Base::Result<std::vector<RawCatalogEntry>, AssetError>
         Parse(std::string_view catalogText, std::string_view sourceName = "asset_catalog.json");
+
+        Base::Result<std::vector<RawCatalogEntryView>, AssetError>
+        ParseViews(std::string_view catalogText, std::string_view sourceName = "asset_catalog.json");
+
+    private:
+        // エスケープを復元した文字列（deque なので追加しても既存要素は動かない）
+        std::deque<std::string> unescaped_;
     };
 
 } // namespace Engine::Asset::Catalog
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Engine::Asset::Catalog::Compiled {
+
+    // バイナリ catalog 形式（CatalogCompiler が書き、AssetCatalog::LoadCompiled が mmap して読む。すべてリトルエンディアン）
+    //
+    //   [Header 64B][Seed u32 * bucketCount][Entry 32B * entryCount][string pool]
+    //
+    //   - Entry は最小完全ハッシュ（CHD 方式）の slot 順に並ぶ。slot 数 = entryCount（空き slot 無し）
+    //     bucket = BucketOf(id) → seed = seeds[bucket] → slot = SlotOf(id, seed)
+    //     seed の最上位ビットが立っていれば下位ビットがそのまま slot（1 キーだけの bucket 用）
+    //   - 表に無い id も何かの slot に落ちるので、Entry の idKey と比べて確かめる
+    //   - path は string pool 内の (offset, length)。各文字列の後ろに '\0' を置く
+    //   - resolvedPath はコンパイル時の AssetPathResolver で解決済み（assetsRoot は実行時と揃えること）
+
+    inline constexpr char          kMagic[4]    = { 'O', 'T', 'C', 'T' };
+    inline constexpr std::uint32_t kVersion     = 1;
+    inline constexpr std::size_t   kHeaderSize  = 64;
+    inline constexpr std::size_t   kSeedSize    = 4;
+    inline constexpr std::size_t   kEntrySize   = 32;
+    inline constexpr std::uint32_t kDirectSlot  = 0x80000000u;
+
+    struct Header final {
+        std::uint32_t version = kVersion;
+        std::uint32_t entryCount = 0;
+        std::uint32_t bucketCount = 0;
+        std::uint64_t salt = 0;
+        std::uint64_t seedsOffset = 0;
+        std::uint64_t entriesOffset = 0;
+        std::uint64_t stringsOffset = 0;
+        std::uint64_t stringsSize = 0;
+    };
+
+    struct Entry final {
+        std::uint64_t idKey = 0;   // AssetId::value
+        std::uint64_t typeKey = 0; // AssetType::value
+        std::uint32_t sourceOffset = 0;
+        std::uint32_t sourceLength = 0;
+        std::uint32_t resolvedOffset = 0;
+        std::uint32_t resolvedLength = 0;
+    };
+
+    // ---- ハッシュ ----
+    // id は FNV 済みだが、bucket と slot で別の値が欲しいので混ぜ直す
+    inline std::uint64_t Mix64(std::uint64_t x) noexcept {
+        x ^= x >> 30;
+        x *= 0xBF58476D1CE4E5B9ull;
+        x ^= x >> 27;
+        x *= 0x94D049BB133111EBull;
+        x ^= x >> 31;
+        return x;
+    }
+
+    // [0, n) へ（剰余の代わりに 32x32 の乗算）
+    inline std::uint32_t Reduce(std::uint32_t h, std::uint32_t n) noexcept {
+        return static_cast<std::uint32_t>((static_cast<std::uint64_t>(h) * n) >> 32);
+    }
+
+    inline std::uint32_t BucketOf(std::uint64_t key, std::uint64_t salt, std::uint32_t bucketCount) noexcept {
+        return Reduce(static_cast<std::uint32_t>(Mix64(key ^ salt) >> 32), bucketCount);
+    }
+
+    inline std::uint32_t SlotOf(std::uint64_t key, std::uint64_t salt, std::uint32_t seed, std::uint32_t entryCount) noexcept {
+        const std::uint64_t h = Mix64(key ^ salt ^ ((seed + 1ull) * 0x9E3779B97F4A7C15ull));
+        return Reduce(static_cast<std::uint32_t>(h), entryCount);
+    }
+
+    // ---- LE 読み書き ----
+    inline void StoreU32(std::byte* p, std::uint32_t v) noexcept {
+        for (int i = 0; i < 4; ++i) p[i] = static_cast<std::byte>((v >> (8 * i)) & 0xFFu);
+    }
+    inline void StoreU64(std::byte* p, std::uint64_t v) noexcept {
+        for (int i = 0; i < 8; ++i) p[i] = static_cast<std::byte>((v >> (8 * i)) & 0xFFu);
+    }
+    inline std::uint32_t LoadU32(const std::byte* p) noexcept {
+        std::uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) v |= static_cast<std::uint32_t>(p[i]) << (8 * i);
+        return v;
+    }
+    inline std::uint64_t LoadU64(const std::byte* p) noexcept {
+        std::uint64_t v = 0;
+        for (int i = 0; i < 8; ++i) v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+        return v;
+    }
+
+    inline void WriteHeader(std::byte* p, const Header& h) noexcept {
+        std::memset(p, 0, kHeaderSize);
+        std::memcpy(p, kMagic, 4);
+        StoreU32(p + 4, h.version);
+        StoreU32(p + 8, h.entryCount);
+        StoreU32(p + 12, h.bucketCount);
+        StoreU64(p + 16, h.salt);
+        StoreU64(p + 24, h.seedsOffset);
+        StoreU64(p + 32, h.entriesOffset);
+        StoreU64(p + 40, h.stringsOffset);
+        StoreU64(p + 48, h.stringsSize);
+    }
+
+    // magic が違えば false
+    inline bool ReadHeader(const std::byte* p, Header& out) noexcept {
+        if (std::memcmp(p, kMagic, 4) != 0) return false;
+        out.version = LoadU32(p + 4);
+        out.entryCount = LoadU32(p + 8);
+        out.bucketCount = LoadU32(p + 12);
+        out.salt = LoadU64(p + 16);
+        out.seedsOffset = LoadU64(p + 24);
+        out.entriesOffset = LoadU64(p + 32);
+        out.stringsOffset = LoadU64(p + 40);
+        out.stringsSize = LoadU64(p + 48);
+        return true;
+    }
+
+    inline void WriteEntry(std::byte* p, const Entry& e) noexcept {
+        StoreU64(p + 0, e.idKey);
+        StoreU64(p + 8, e.typeKey);
+        StoreU32(p + 16, e.sourceOffset);
+        StoreU32(p + 20, e.sourceLength);
+        StoreU32(p + 24, e.resolvedOffset);
+        StoreU32(p + 28, e.resolvedLength);
+    }
+
+    inline Entry ReadEntry(const std::byte* p) noexcept {
+        Entry e;
+        e.idKey = LoadU64(p + 0);
+        e.typeKey = LoadU64(p + 8);
+        e.sourceOffset = LoadU32(p + 16);
+        e.sourceLength = LoadU32(p + 20);
+        e.resolvedOffset = LoadU32(p + 24);
+        e.resolvedLength = LoadU32(p + 28);
+        return e;
+    }
+
+} // namespace Engine::Asset::Catalog::Compiled
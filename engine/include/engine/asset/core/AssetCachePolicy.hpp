@@ -1,11 +1,15 @@
 #pragma once
 
 #include <cstdint>
+#include <unordered_map>
+#include <utility>
 
 #include "engine/asset/AssetState.hpp"
+#include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AssetLifetime.hpp"
 #include "engine/asset/core/AssetStatistics.hpp"
 #include "engine/asset/core/AssetRecord.hpp"
+#include "engine/asset/core/EvictionStrategy.hpp"
 
 namespace Engine::Asset::Core {
 
@@ -28,6 +32,11 @@ public:
         // 0なら即時evict可
         std::uint64_t keepAliveFrames = 0;
 
+        // type ごとの TTL（登録した type は keepAliveFrames の代わりにこちらを使う）
+        // 例：UI の効果音は数秒残し、巨大なテクスチャは参照が切れたらすぐ回収する
+        // asset ごとの上書き（AssetRequest::keepAliveFramesOverride → AssetLifetime）はさらに優先
+        std::unordered_map<AssetType, std::uint64_t> keepAliveFramesPerType{};
+
         // Failed をキャッシュに残すか（連続リトライ抑止）
         // falseなら refCount==0 & expired で消してOK
         bool keepFailedRecords = true;
@@ -35,13 +44,22 @@ public:
         // Budget（mode==Budgeted のときだけ意味を持つ）
         // 0なら無制限
         std::uint32_t maxAssets = 0;          // 「キャッシュ数」の上限（AssetManagerが現数を渡す）
-        std::uint64_t maxBytesRead = 0;       // 「読み込み総量」ではなく “現在の推定常駐” を渡す想定（任意）
+        std::uint64_t maxBytesRead = 0;       // 常駐バイト数の合計の上限（AssetManager が IAssetLoader::ResidentBytes を集計して渡す）
+
+        // type ごとの常駐バイト数の上限（未登録 / 0 なら無制限）
+        // テクスチャとテキストでは 1 個の大きさが桁違いなので、数より bytes で絞る
+        std::unordered_map<AssetType, std::uint64_t> maxResidentBytesPerType{};
+
+        // 上限を超えたときにどれから消すか（Budgeted のときだけ意味を持つ）
+        // - Lru：参照が切れた順（既定）。Lfu / Arc / Gdsf は AssetManager が IEvictionStrategy を持って順番を決める
+        // - どれが良いかは EvictionSimulator に記録したアクセス列を流して比べる
+        EvictionAlgorithm eviction = EvictionAlgorithm::Lru;
     };
 
 public:
-    explicit AssetCachePolicy(Options opt) : opt_(opt) {}
+    explicit AssetCachePolicy(Options opt) : opt_(std::move(opt)) {}
 
-    void SetOptions(Options opt) { opt_ = opt; }
+    void SetOptions(Options opt) { opt_ = std::move(opt); }
     const Options& GetOptions() const noexcept { return opt_; }
 
     // 破棄（evict/erase）して良いか？
@@ -59,7 +77,14 @@ public:
         if (rec.state == AssetState::Failed && opt_.keepFailedRecords) return false;
 
         // refCount + pinned + TTL
-        return lifetime.CanEvict(rec.id, nowFrame, rec.refCount, opt_.keepAliveFrames);
+        return lifetime.CanEvict(rec.id, nowFrame, rec.refCount, KeepAliveFramesFor(rec.type));
+    }
+
+    // type の既定 TTL（type 別の登録が無ければ keepAliveFrames）
+    std::uint64_t KeepAliveFramesFor(AssetType type) const noexcept {
+        if (opt_.keepAliveFramesPerType.empty()) return opt_.keepAliveFrames;
+        auto it = opt_.keepAliveFramesPerType.find(type);
+        return (it == opt_.keepAliveFramesPerType.end()) ? opt_.keepAliveFrames : it->second;
     }
 
     // Budget 超過時に「trim したいか」の判断（選別・何個消すかは Manager）
@@ -73,6 +98,19 @@ public:
         return false;
     }
 
+    // type ごとの常駐バイト上限（0 なら無制限）
+    std::uint64_t GetTypeByteBudget(AssetType type) const noexcept {
+        auto it = opt_.maxResidentBytesPerType.find(type);
+        return (it == opt_.maxResidentBytesPerType.end()) ? 0 : it->second;
+    }
+
+    // type の常駐バイト数が上限を超えているか（Budgeted のときだけ）
+    bool ShouldTrimType(AssetType type, std::uint64_t residentBytesOfType) const noexcept {
+        if (opt_.mode != Mode::Budgeted) return false;
+        const std::uint64_t limit = GetTypeByteBudget(type);
+        return limit != 0 && residentBytesOfType > limit;
+    }
+
 private:
     Options opt_{};
 };
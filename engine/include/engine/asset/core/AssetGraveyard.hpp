@@ -0,0 +1,80 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "engine/asset/core/AnyAsset.hpp"
+
+namespace Engine::Asset::Core {
+
+// AssetGraveyard:
+// - evict した asset の破棄（最後の shared_ptr を手放す = デストラクタと free）を background thread で行う
+//   64 MiB の RGBA を main thread で free するとフレームにスパイクが出るため
+// - Bury で預かり、thread が batchSize 件ずつ lock の外で破棄する（1 バッチの長さに上限をつける）
+// - 溜まったバイト数が maxPendingBytes を超えたら、Bury した thread が古い分をその場で破棄して上限に戻す
+//   （background が追いつかないときにメモリが膨らみ続けない）
+// - 他で shared_ptr を持っていれば、ここで手放しても実体は残る（最後の持ち主が破棄する）
+class AssetGraveyard final {
+public:
+    struct Options final {
+        std::size_t batchSize = 16;                  // 1 バッチで破棄する件数（0 なら 1）
+        std::uint64_t maxPendingBytes = 256ull << 20; // 0 なら無制限
+    };
+
+    struct Counters final {
+        std::uint64_t buried = 0;
+        std::uint64_t destroyedInBackground = 0;
+        std::uint64_t destroyedInline = 0;           // maxPendingBytes を超えて Bury 側で破棄した数
+    };
+
+public:
+    AssetGraveyard();
+    explicit AssetGraveyard(Options opt);
+    ~AssetGraveyard(); // 残りはすべて破棄してから thread を止める
+
+    AssetGraveyard(const AssetGraveyard&) = delete;
+    AssetGraveyard& operator=(const AssetGraveyard&) = delete;
+
+    void SetOptions(Options opt);
+    Options GetOptions() const;
+
+    // bytes：asset の常駐バイト（AssetRecord::residentBytes）。maxPendingBytes の判定に使う
+    void Bury(AnyAsset asset, std::uint64_t bytes);
+
+    // 預かっている分がすべて破棄されるまで待つ（ロード画面 / 終了処理 / テスト用）
+    void Flush();
+
+    std::size_t PendingCount() const;
+    std::uint64_t PendingBytes() const;
+    Counters GetCounters() const;
+
+private:
+    struct Body final {
+        AnyAsset asset;
+        std::uint64_t bytes = 0;
+    };
+
+    void ThreadMain_();
+
+private:
+    mutable std::mutex mtx_;
+    std::condition_variable workCv_;
+    std::condition_variable idleCv_;
+
+    Options opt_{};
+    std::deque<Body> pending_;
+    std::uint64_t pendingBytes_ = 0; // 破棄中のバッチを含む
+    std::size_t destroying_ = 0;     // thread が破棄中の件数
+    Counters counters_{};
+    bool stopping_ = false;
+
+    std::thread thread_;
+};
+
+} // namespace Engine::Asset::Core
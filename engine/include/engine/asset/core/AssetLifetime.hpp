@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <unordered_map>
 
@@ -14,18 +15,38 @@ namespace Engine::Asset::Core {
 // 用途：
 // - keepAliveFrames（TTL）
 // - pin/unpin（強制保持）
+// - asset ごとの TTL 上書き（AssetRequest::keepAliveFramesOverride。evict すると消える）
 // - lastAccessFrame に基づく eviction 判定
+// - 参照の無い（refCount == 0）asset の LRU リスト（Budgeted の自動 evict が古い側から引く）
+//   Info に prev/next を持たせた intrusive list なので、付け外し・先頭へ移すのは O(1)
 class AssetLifetime final {
 public:
     struct Info final {
         std::uint64_t lastAccessFrame = 0; // 最後に Get/Use されたフレーム
         std::uint64_t lastLoadedFrame = 0; // 最後にロード完了したフレーム（任意）
         bool pinned = false;              // 強制保持
+        std::uint64_t keepAliveOverride = 0; // この asset だけの TTL（AssetRequest::keepAliveFramesOverride。0 なら使わない）
+
+        // LRU リスト（AssetLifetime が管理する。外から書き換えない）
+        AssetId id{};
+        Info* lruPrev = nullptr;
+        Info* lruNext = nullptr;
+        bool inLru = false;
     };
 
 public:
+    AssetLifetime() = default;
+
+    // LRU リストが Info のアドレスを持つのでコピーしない
+    AssetLifetime(const AssetLifetime&) = delete;
+    AssetLifetime& operator=(const AssetLifetime&) = delete;
+
     void Clear() {
         infos_.clear();
+        overrideCount_ = 0;
+        lruHead_ = nullptr;
+        lruTail_ = nullptr;
+        lruSize_ = 0;
     }
 
     bool Has(const AssetId& id) const noexcept {
@@ -50,6 +71,10 @@ public:
     void Touch(const AssetId& id, std::uint64_t nowFrame) {
         auto& inf = infos_[id];
         inf.lastAccessFrame = nowFrame;
+        if (inf.inLru) {
+            LruUnlink_(inf);
+            LruPushBack_(inf);
+        }
     }
 
     // 呼び出しポイント：ロード成功時
@@ -57,13 +82,47 @@ public:
         auto& inf = infos_[id];
         inf.lastLoadedFrame = nowFrame;
         inf.lastAccessFrame = nowFrame;
+        if (inf.inLru) {
+            LruUnlink_(inf);
+            LruPushBack_(inf);
+        }
     }
 
     // 呼び出しポイント：evict/erase 時
     void OnEvicted(const AssetId& id) {
-        infos_.erase(id);
+        auto it = infos_.find(id);
+        if (it == infos_.end()) return;
+        if (it->second.inLru) LruUnlink_(it->second);
+        if (it->second.keepAliveOverride != 0) --overrideCount_;
+        infos_.erase(it);
     }
 
+    // 呼び出しポイント：refCount が 0 になったとき（Release など）。LRU の新しい側へ入れる
+    void OnUnreferenced(const AssetId& id, std::uint64_t nowFrame) {
+        auto& inf = infos_[id];
+        inf.id = id;
+        inf.lastAccessFrame = nowFrame;
+        if (inf.inLru) LruUnlink_(inf);
+        LruPushBack_(inf);
+    }
+
+    // 呼び出しポイント：refCount が 0 → 1 になったとき。LRU から外す
+    void OnReferenced(const AssetId& id) {
+        auto it = infos_.find(id);
+        if (it != infos_.end() && it->second.inLru) LruUnlink_(it->second);
+    }
+
+    // 参照の無い asset を古い順に fn(id, info) へ渡す。fn が false を返したら止める
+    // （fn の中で LRU を変えない：evict は列挙を終えてから行う）
+    template <class Fn>
+    void ForEachUnreferenced(Fn&& fn) const {
+        for (const Info* p = lruHead_; p; p = p->lruNext) {
+            if (!fn(p->id, *p)) return;
+        }
+    }
+
+    std::size_t UnreferencedCount() const noexcept { return lruSize_; }
+
     void Pin(const AssetId& id) {
         infos_[id].pinned = true;
     }
@@ -78,20 +137,40 @@ public:
         return (it != infos_.end()) ? it->second.pinned : false;
     }
 
-    // keepAliveFrames:
+    // この asset だけ TTL を上書きする（0 で解除。policy の既定 / type 別の値より優先）
+    void SetKeepAliveOverride(const AssetId& id, std::uint64_t keepAliveFrames) {
+        auto& inf = infos_[id];
+        if ((inf.keepAliveOverride != 0) != (keepAliveFrames != 0)) {
+            if (keepAliveFrames != 0) ++overrideCount_;
+            else --overrideCount_;
+        }
+        inf.keepAliveOverride = keepAliveFrames;
+    }
+
+    std::uint64_t GetKeepAliveOverride(const AssetId& id) const noexcept {
+        auto it = infos_.find(id);
+        return (it != infos_.end()) ? it->second.keepAliveOverride : 0;
+    }
+
+    // TTL を上書きしている asset の数（0 なら全 asset が同じ規則の TTL）
+    std::size_t KeepAliveOverrideCount() const noexcept { return overrideCount_; }
+
+    // keepAliveFrames（policy の既定 / type 別の値。asset ごとの上書きがあればそちらを使う）:
     // - 0 なら「refCount==0 になったら即evict可」
     // - 60*5 なら「参照が切れても 5秒（60fps想定）保持」
     bool IsExpired(const AssetId& id, std::uint64_t nowFrame, std::uint64_t keepAliveFrames) const noexcept {
-        if (keepAliveFrames == 0) return true;
-
         auto it = infos_.find(id);
         if (it == infos_.end()) {
             // 情報が無い場合は「古い」とみなす（evictしやすく）
             return true;
         }
 
-        const auto last = it->second.lastAccessFrame;
-        return (nowFrame >= last) ? ((nowFrame - last) >= keepAliveFrames) : true;
+        const Info& inf = it->second;
+        const std::uint64_t ttl = (inf.keepAliveOverride != 0) ? inf.keepAliveOverride : keepAliveFrames;
+        if (ttl == 0) return true;
+
+        const auto last = inf.lastAccessFrame;
+        return (nowFrame >= last) ? ((nowFrame - last) >= ttl) : true;
     }
 
     // refCount と pinned と TTL から「evict可能か」を判断する共通関数
@@ -105,7 +184,35 @@ public:
     }
 
 private:
+    void LruPushBack_(Info& inf) noexcept {
+        inf.lruPrev = lruTail_;
+        inf.lruNext = nullptr;
+        if (lruTail_) lruTail_->lruNext = &inf;
+        else lruHead_ = &inf;
+        lruTail_ = &inf;
+        inf.inLru = true;
+        ++lruSize_;
+    }
+
+    void LruUnlink_(Info& inf) noexcept {
+        if (inf.lruPrev) inf.lruPrev->lruNext = inf.lruNext;
+        else lruHead_ = inf.lruNext;
+        if (inf.lruNext) inf.lruNext->lruPrev = inf.lruPrev;
+        else lruTail_ = inf.lruPrev;
+        inf.lruPrev = nullptr;
+        inf.lruNext = nullptr;
+        inf.inLru = false;
+        --lruSize_;
+    }
+
+private:
+    // unordered_map の要素は rehash でも動かないので、Info* をリストに使える
     std::unordered_map<AssetId, Info> infos_;
+    std::size_t overrideCount_ = 0;
+
+    Info* lruHead_ = nullptr; // いちばん古い
+    Info* lruTail_ = nullptr; // いちばん新しい
+    std::size_t lruSize_ = 0;
 };
 
 } // namespace Engine::Asset::Core
@@ -4,6 +4,7 @@
 #include <string>
 #include <utility>
 
+#include "engine/asset/AssetHandle.hpp"
 #include "engine/asset/AssetId.hpp"
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/AssetState.hpp"
@@ -29,8 +30,12 @@ namespace Engine::Asset::Core {
         AssetState state = AssetState::Unloaded;
 
         // 世代：AssetHandle の stale 検出に使える（AssetManager側で運用）
+        // AssetStorage は slot を再利用するとき前の世代より大きい値から始める（古い handle は一致しない）
         std::uint32_t generation = 1;
 
+        // AssetStorage 内の位置（AssetHandle に載せる。AssetStorage が設定する）
+        std::uint32_t slot = AssetHandle::kNoSlot;
+
         // 実体（型消去）
         AnyAsset asset{};
 
@@ -40,6 +45,12 @@ namespace Engine::Asset::Core {
         // “参照数”をここで持つかは好みだが、Storageに置くとデバッグに強い
         std::uint32_t refCount = 0;
 
+        // asset が常駐させているバイト数（IAssetLoader::ResidentBytes。AssetManager が byte budget 用に集計する）
+        std::uint64_t residentBytes = 0;
+
+        // 最後のロードで source から読んだバイト数（evict したら読み直しにかかる量。GDSF のコスト）
+        std::uint64_t sourceBytes = 0;
+
         // ---- helpers ----
         bool IsReady() const noexcept { return state == AssetState::Ready; }
         bool IsFailed() const noexcept { return state == AssetState::Failed; }
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "engine/asset/AssetId.hpp"
 #include "engine/asset/AssetType.hpp"
@@ -12,52 +16,68 @@
 
 namespace Engine::Asset::Core {
 
+class AssetGraveyard;
+
 // AssetStorage:
 // - map<AssetId, AssetRecord> の所有者
-// - record のアドレス安定性を確保するため、unique_ptr で保持する
-//   （unordered_map の rehash で参照が壊れる問題を避ける）
+// - record は slot 配列（256 件ずつの chunk）に直接並べる。chunk は動かないので record のアドレスは安定
+// - 各 record は slot 番号を持ち、AssetHandle に載せれば Resolve で 1 回の添字アクセス + 世代比較で引ける
+//
+// 並行アクセス：
+// - AssetId → record の索引は、ハッシュで shard に分けたオープンアドレスの表
+// - Find / Contains / GetOrCreate のヒット / Resolve はロック無し
+// - 追加・削除は shard の mutex 下で表の slot を書き換える。表が埋まったら新しい表を作って差し替える（RCU 風）
+// - 差し替えた古い表と削除した record の slot はすぐには再利用せず、ReclaimRetired（同期点）でまとめて片付ける
+//   → 他スレッドが Find 中 / record を参照中でも、別の asset に入れ替わったメモリには触れない
+// - 削除した時点で slot の世代を進めるので、古い handle の Resolve はすぐ nullptr になる
+// - record の中身（state / asset など）の同期は呼び出し側の責務（AssetManager は main thread で更新する）
+//
+// 容量：slot 配列の長さには上限がある（Options::maxRecords、既定 1Mi）
+// - chunk のアドレス表を伸ばさない（読み手がロック無しで辿るため）ので、上限は構築時に決める
+// - 削除した record の slot も ReclaimRetired までは埋まったまま数える
+//   （1 フレームの中で作っては消すを繰り返すと、live な数より先に上限に届く）
+// - 上限に届いたら GetOrCreate は nullptr を返す（AssetManager::Load は InternalError を返す）
 class AssetStorage final {
 public:
-    AssetStorage() = default;
+    struct Options final {
+        // 同時に持てる record 数の上限（退役済みで未回収の slot も含む）。kChunkSize 単位に切り上げる
+        std::uint32_t maxRecords = 1u << 20;
+    };
 
-    void Clear() {
-        records_.clear();
-    }
+    AssetStorage();
+    explicit AssetStorage(Options opt);
+    ~AssetStorage();
 
-    std::size_t Size() const noexcept { return records_.size(); }
+    AssetStorage(const AssetStorage&) = delete;
+    AssetStorage& operator=(const AssetStorage&) = delete;
 
-    AssetRecord* Find(const AssetId& id) noexcept {
-        auto it = records_.find(id);
-        return it == records_.end() ? nullptr : it->second.get();
-    }
+    // 全 record を空にする（同期点でのみ呼ぶ。既存の handle はすべて stale になる）
+    void Clear();
 
-    const AssetRecord* Find(const AssetId& id) const noexcept {
-        auto it = records_.find(id);
-        return it == records_.end() ? nullptr : it->second.get();
-    }
+    std::size_t Size() const noexcept { return size_.load(std::memory_order_relaxed); }
 
-    bool Contains(const AssetId& id) const noexcept {
-        return records_.find(id) != records_.end();
-    }
+    AssetRecord* Find(const AssetId& id) noexcept;
+    const AssetRecord* Find(const AssetId& id) const noexcept;
 
-    // 無ければ作る。type/path は「初回作成時のみ」設定する（既存なら保持）
-    AssetRecord& GetOrCreate(const AssetId& id, const AssetType& type, std::string resolvedPath = {}) {
-        auto it = records_.find(id);
-        if (it != records_.end()) {
-            return *it->second;
-        }
+    bool Contains(const AssetId& id) const noexcept { return Find(id) != nullptr; }
 
-        auto rec = std::make_unique<AssetRecord>();
-        rec->id = id;
-        rec->type = type;
-        rec->resolvedPath = std::move(resolvedPath);
-        rec->state = AssetState::Unloaded;
+    // slot + 世代から引く（範囲外 / 世代違い = stale なら nullptr）
+    AssetRecord* Resolve(std::uint32_t slot, std::uint32_t generation) noexcept {
+        return const_cast<AssetRecord*>(std::as_const(*this).Resolve(slot, generation));
+    }
 
-        auto* ptr = rec.get();
-        records_.emplace(id, std::move(rec));
-        return *ptr;
+    const AssetRecord* Resolve(std::uint32_t slot, std::uint32_t generation) const noexcept {
+        if (slot >= slotCount_.load(std::memory_order_acquire)) return nullptr;
+        const Chunk* c = chunks_[slot >> kChunkShift].load(std::memory_order_acquire);
+        const AssetRecord& r = c->records[slot & (kChunkSize - 1)];
+        auto& gen = const_cast<std::uint32_t&>(r.generation);
+        return std::atomic_ref<std::uint32_t>(gen).load(std::memory_order_acquire) == generation ? &r : nullptr;
     }
 
+    // 無ければ作る。type/path は「初回作成時のみ」設定する（既存なら保持）
+    // slot が上限（Options::maxRecords）まで埋まっていて作れなければ nullptr
+    AssetRecord* GetOrCreate(const AssetId& id, const AssetType& type, std::string resolvedPath = {});
+
     // “pathだけ後から埋めたい” 用（Catalog構築→Storage作成の順序差に対応）
     void SetResolvedPathIfEmpty(const AssetId& id, std::string resolvedPath) {
         if (auto* r = Find(id)) {
@@ -65,14 +85,16 @@ public:
         }
     }
 
-    // 参照カウント（AssetHandle運用の補助）
+    // 参照カウント（AssetHandle運用の補助）：どのスレッドからでもよい
     void AddRef(const AssetId& id) {
-        if (auto* r = Find(id)) ++r->refCount;
+        if (auto* r = Find(id)) std::atomic_ref<std::uint32_t>(r->refCount).fetch_add(1, std::memory_order_relaxed);
     }
 
     void ReleaseRef(const AssetId& id) {
         if (auto* r = Find(id)) {
-            if (r->refCount > 0) --r->refCount;
+            std::atomic_ref<std::uint32_t> ref(r->refCount);
+            std::uint32_t cur = ref.load(std::memory_order_relaxed);
+            while (cur > 0 && !ref.compare_exchange_weak(cur, cur - 1, std::memory_order_relaxed)) {}
         }
     }
 
@@ -80,20 +102,58 @@ public:
     bool CanEvict(const AssetId& id) const noexcept {
         const auto* r = Find(id);
         if (!r) return false;
-        return r->refCount == 0;
+        auto& count = const_cast<std::uint32_t&>(r->refCount);
+        return std::atomic_ref<std::uint32_t>(count).load(std::memory_order_relaxed) == 0;
     }
 
-    void EraseIf(const AssetId& id, bool force = false) {
-        auto it = records_.find(id);
-        if (it == records_.end()) return;
+    // 表から外す（record の中身の解放と slot の再利用は ReclaimRetired まで遅らせる）
+    void EraseIf(const AssetId& id, bool force = false);
 
-        if (force || it->second->refCount == 0) {
-            records_.erase(it);
-        }
-    }
+    // 同期点：退役した表を解放し、削除した record を空にして slot を再利用可能にする
+    // （戻り値：片付けた record 数）
+    // 他スレッドが Find 中 / 削除済み record を参照中でないタイミングで呼ぶこと
+    // （AssetManager は BeginFrame で呼ぶ）
+    // graveyard を渡すと、record の asset はその場で破棄せず graveyard へ預ける（background で破棄）
+    std::size_t ReclaimRetired(AssetGraveyard* graveyard = nullptr);
+
+    // まだ片付けていない退役 record の数（デバッグ / テスト用）
+    std::size_t RetiredCount() const;
+
+    // 使ったことのある slot 数（= slot 配列の長さ）
+    std::uint32_t SlotCount() const noexcept { return slotCount_.load(std::memory_order_relaxed); }
+
+    // slot 配列の長さの上限（Options::maxRecords を kChunkSize 単位に切り上げたもの）
+    std::uint32_t MaxSlots() const noexcept { return maxChunks_ << kChunkShift; }
 
 private:
-    std::unordered_map<AssetId, std::unique_ptr<AssetRecord>> records_;
+    struct Table;
+    struct Shard;
+
+    static constexpr std::size_t kShardCount = 32;
+
+    static constexpr std::uint32_t kChunkShift = 8;
+    static constexpr std::uint32_t kChunkSize = 1u << kChunkShift;
+    static constexpr std::uint32_t kMaxChunksLimit = (1u << (32 - kChunkShift)) - 1; // slot 数が 32 bit に収まる範囲
+
+    struct Chunk {
+        AssetRecord records[kChunkSize];
+    };
+
+    Shard& ShardOf_(std::uint64_t mixed) const noexcept;
+    AssetRecord* AcquireSlot_(); // 上限に届いていれば nullptr
+    AssetRecord& SlotAt_(std::uint32_t slot) const noexcept;
+
+    std::unique_ptr<Shard[]> shards_;
+    std::atomic<std::size_t> size_{ 0 };
+
+    // slot 配列：chunk のアドレス表は固定長（伸ばさない）なので読み手はロック無しで辿れる
+    std::uint32_t maxChunks_ = 0;
+    std::unique_ptr<std::atomic<Chunk*>[]> chunks_;
+    std::atomic<std::uint32_t> slotCount_{ 0 };
+
+    mutable std::mutex slotMutex_; // slotCount_ の伸長 / freeSlots_ / retiredSlots_
+    std::vector<std::uint32_t> freeSlots_;
+    std::vector<std::uint32_t> retiredSlots_;
 };
 
 } // namespace Engine::Asset::Core
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/core/EvictionStrategy.hpp"
+#include "engine/asset/detail/Span.hpp"
+
+namespace Engine::Asset::Core {
+
+    // アクセス記録 1 件（AssetManager::SetAccessTrace で記録できる）
+    struct EvictionTraceEvent final {
+        AssetId id{};
+        std::uint64_t bytes = 0;      // 常駐バイト（IAssetLoader::ResidentBytes）
+        std::uint64_t reloadCost = 0; // 読み直しにかかる量（source bytes。0 なら bytes を使う）
+    };
+
+    // EvictionSimulator：記録したアクセス列を置換アルゴリズムに流し、容量内でのヒット / 読み直し量を数える
+    // - アクセスされた asset はそのアクセスの間は参照中とみなす（直後の evict 対象にしない）
+    // - それ以外の常駐 asset はいつでも消せるものとして扱う（pin / TTL は再現しない）
+    // - 自分のゲームの記録で Compare を回し、reloadBytes が少ないアルゴリズムを選ぶ用途
+    class EvictionSimulator final {
+    public:
+        struct Options final {
+            // 0 なら無制限（両方 0 なら何も消えない）
+            std::uint64_t capacityBytes = 0;
+            std::size_t capacityCount = 0;
+        };
+
+        struct Result final {
+            std::uint64_t accesses = 0;
+            std::uint64_t hits = 0;
+            std::uint64_t misses = 0;
+            std::uint64_t evictions = 0;
+            std::uint64_t missBytes = 0;         // ミスで読んだ量の合計（初回の読み込みを含む）
+            std::uint64_t reloadBytes = 0;       // 一度消したものを読み直した量（アルゴリズムの差が出るのはここ）
+            std::uint64_t peakResidentBytes = 0;
+
+            double HitRate() const noexcept {
+                return accesses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(accesses);
+            }
+        };
+
+        explicit EvictionSimulator(Options opt) : opt_(opt) {}
+
+        void SetOptions(Options opt) { opt_ = opt; }
+        const Options& GetOptions() const noexcept { return opt_; }
+
+        // strategy は Clear してから使う
+        Result Run(IEvictionStrategy& strategy, Detail::ConstSpan<EvictionTraceEvent> trace) const;
+
+        // 全アルゴリズムで回し、reloadBytes の少ない順に並べて返す（同じなら hits の多い順）
+        std::vector<std::pair<EvictionAlgorithm, Result>> Compare(Detail::ConstSpan<EvictionTraceEvent> trace) const;
+
+    private:
+        Options opt_{};
+    };
+
+} // namespace Engine::Asset::Core
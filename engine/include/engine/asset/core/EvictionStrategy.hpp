@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "engine/asset/AssetId.hpp"
+
+namespace Engine::Asset::Core {
+
+    // 置換アルゴリズムの種類（AssetCachePolicy::Options::eviction で選ぶ）
+    enum class EvictionAlgorithm : std::uint8_t {
+        Lru = 0, // 参照が切れた順（AssetLifetime の LRU リストをそのまま使う）
+        Lfu,     // ヒット回数の少ない順（同数なら古い順）
+        Arc,     // Adaptive Replacement Cache：recency と frequency の配分を ghost のヒットで調整する
+        Gdsf,    // GreedyDual-Size-Frequency：頻度 * 読み直しコスト / 常駐サイズ の小さい順（aging 付き）
+    };
+
+    // IEvictionStrategy：Budgeted の trim で「どれから消すか」の順番を決める
+    // - AssetManager（や EvictionSimulator）が常駐 asset の出入りとヒットを通知する
+    // - 消して良いか（refCount / pin / TTL / Loading）は AssetCachePolicy::IsEvictable が判断する。ここは順番だけ
+    // - スレッドセーフではない（main thread から使う）
+    class IEvictionStrategy {
+    public:
+        virtual ~IEvictionStrategy() = default;
+
+        virtual EvictionAlgorithm Algorithm() const noexcept = 0;
+
+        // 常駐した（bytes：常駐バイト、reloadCost：消したら読み直しにかかる量。source から読むバイト数）
+        // 既に常駐中なら大きさを更新してアクセス扱い
+        virtual void OnInsert(const AssetId& id, std::uint64_t bytes, std::uint64_t reloadCost) = 0;
+
+        // 常駐中の asset が使われた（常駐していなければ何もしない）
+        virtual void OnAccess(const AssetId& id) = 0;
+
+        // 常駐から外れた（evict / 失敗で中身を失ったとき）
+        virtual void OnRemove(const AssetId& id) = 0;
+
+        virtual bool Contains(const AssetId& id) const noexcept = 0;
+        virtual std::size_t Size() const noexcept = 0;
+        virtual void Clear() = 0;
+
+        // 消したい順に fn(id) へ渡す。fn が false を返したら止める
+        // （fn の中で On* を呼ばない：消すのは列挙を終えてから）
+        virtual void ForEachVictim(const std::function<bool(const AssetId&)>& fn) const = 0;
+    };
+
+    // algorithm に対応する実装を作る
+    // - arcCapacity：ARC が ghost を何件まで覚えるか（0 なら常駐数に合わせる）
+    std::unique_ptr<IEvictionStrategy> MakeEvictionStrategy(EvictionAlgorithm algorithm,
+                                                            std::size_t arcCapacity = 0);
+
+} // namespace Engine::Asset::Core
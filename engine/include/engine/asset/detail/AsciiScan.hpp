@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine::Asset::Detail {
+
+    // AsciiScan：ASCII の数値テキストを速く読むための走査
+    // - 64 バイト単位で「数字 / 空白」を SIMD（SSE2）で分類してビットマスク化し、
+    //   数字列の切れ目をビット演算で拾って、各数値は分岐なしで 1..3 桁を組み立てる
+    // - 数字と空白以外（コメント '#' / 符号など）・範囲外・途中終端を見つけたら false を返すだけ。
+    //   呼び出し側は従来の逐次パーサで読み直す（エラー内容はそちらで揃える）
+
+    // 空白区切りの 10 進数（0..255）を pixels*3 個読み、RGBA（alpha = 255）として rgba へ書く
+    // 成功なら true、p は最後の数値の直後へ進む。失敗時 p と rgba の内容は不定
+    bool ParseAsciiRgbToRgba(const char*& p, const char* end, std::uint8_t* rgba, std::size_t pixels) noexcept;
+
+} // namespace Engine::Asset::Detail
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "engine/asset/detail/Span.hpp"
+
+namespace Engine::Asset::Detail {
+
+    // ByteBlob：所有コピー か 借用ビュー（+ 寿命を握る owner）のどちらかで持つバイト列
+    // - Blob 系 asset（BinaryAsset / FontAsset）の中身。読み出しはどちらでも Bytes() だけ
+    // - 中の保持形態は private（「所有コピーの方を読んだら空だった」を起こさない）
+    class ByteBlob final {
+    public:
+        ByteBlob() = default;
+
+        // bytes をコピーして持つ
+        static ByteBlob Copy(ConstSpan<std::byte> bytes) {
+            ByteBlob b;
+            b.owned_.assign(bytes.begin(), bytes.end());
+            b.view_ = ConstSpan<std::byte>{ b.owned_.data(), b.owned_.size() };
+            return b;
+        }
+
+        // view を参照し、owner で寿命を握る（owner が無ければ Copy と同じ）
+        static ByteBlob Borrow(ConstSpan<std::byte> view, std::shared_ptr<const void> owner) {
+            if (!owner) return Copy(view);
+            ByteBlob b;
+            b.view_ = view;
+            b.owner_ = std::move(owner);
+            return b;
+        }
+
+        // vector の移動でバッファの位置は変わらないので view_ はそのまま使える（移動元は空にする）
+        ByteBlob(ByteBlob&& other) noexcept
+            : owned_(std::move(other.owned_)), view_(std::exchange(other.view_, {})), owner_(std::move(other.owner_)) {}
+        ByteBlob& operator=(ByteBlob&& other) noexcept {
+            owned_ = std::move(other.owned_);
+            view_ = std::exchange(other.view_, {});
+            owner_ = std::move(other.owner_);
+            return *this;
+        }
+        ByteBlob(const ByteBlob& other) { *this = other; }
+        ByteBlob& operator=(const ByteBlob& other) {
+            if (this == &other) return *this;
+            owner_ = other.owner_;
+            owned_ = other.owned_;
+            view_ = owner_ ? other.view_ : ConstSpan<std::byte>{ owned_.data(), owned_.size() };
+            return *this;
+        }
+
+        ConstSpan<std::byte> Bytes() const noexcept { return view_; }
+        std::size_t Size() const noexcept { return view_.size(); }
+        bool Empty() const noexcept { return view_.empty(); }
+
+        // 借用ビュー（mmap / 共有バッファなど）を参照しているなら true
+        bool IsBorrowed() const noexcept { return owner_ != nullptr; }
+
+        // 所有コピーの確保量（借用なら 0）
+        std::size_t OwnedCapacity() const noexcept { return owned_.capacity(); }
+
+    private:
+        std::vector<std::byte> owned_;
+        ConstSpan<std::byte> view_{};
+        std::shared_ptr<const void> owner_{};
+    };
+
+} // namespace Engine::Asset::Detail
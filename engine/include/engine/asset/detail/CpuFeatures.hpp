@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Engine::Asset::Detail {
+
+    // 実行時に選ぶ SIMD 実装の段階（x86/x64 以外は常に Scalar）
+    enum class SimdLevel : std::uint8_t {
+        Scalar,
+        Ssse3,
+        Avx2,
+    };
+
+    // この CPU で使える最上位（初回呼び出しで判定してキャッシュ）
+    SimdLevel DetectSimdLevel() noexcept;
+
+} // namespace Engine::Asset::Detail
+
+// SIMD カーネル実装側（.cpp）向け：関数単位で命令セットを有効にする
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define ENGINE_ASSET_X86 1
+    #if defined(_MSC_VER) && !defined(__clang__)
+        // MSVC は target 指定なしで各命令セットの intrinsic を使える
+        #define ENGINE_ASSET_TARGET(isa)
+    #else
+        #define ENGINE_ASSET_TARGET(isa) __attribute__((target(isa)))
+    #endif
+#endif
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Engine::Asset::Detail {
+
+    // DefaultInitAllocator：引数なし construct を「値初期化」ではなく「デフォルト初期化」にする allocator
+    // - std::vector<uint8_t>::resize(n) の 0 埋めを省ける（直後に全要素を上書きするバッファ向け）
+    // - 引数ありの construct は通常どおり
+    template <class T, class A = std::allocator<T>>
+    class DefaultInitAllocator : public A {
+        using Traits = std::allocator_traits<A>;
+
+    public:
+        template <class U>
+        struct rebind {
+            using other = DefaultInitAllocator<U, typename Traits::template rebind_alloc<U>>;
+        };
+
+        using A::A;
+        DefaultInitAllocator() = default;
+
+        template <class U>
+        void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>) {
+            ::new (static_cast<void*>(p)) U;
+        }
+
+        template <class U, class... Args>
+        void construct(U* p, Args&&... args) {
+            Traits::construct(static_cast<A&>(*this), p, std::forward<Args>(args)...);
+        }
+    };
+
+} // namespace Engine::Asset::Detail
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/detail/Span.hpp"
+
+namespace Engine::Asset::Detail {
+
+    // FileMapping：読み取り専用のファイルマッピング（RAII）
+    // - POSIX: mmap / Windows: CreateFileMapping + MapViewOfFile
+    // - どちらも使えない環境では全読みしたバッファで代用する（API は同じ）
+    // - shared_ptr で共有し、最後の参照が外れたら unmap する
+    class FileMapping final {
+    public:
+        using AssetError = Base::Error<AssetErrorCode>;
+
+        static Base::Result<std::shared_ptr<const FileMapping>, AssetError> Open(std::string_view path);
+
+        ~FileMapping();
+
+        FileMapping(const FileMapping&) = delete;
+        FileMapping& operator=(const FileMapping&) = delete;
+
+        const std::byte* data() const noexcept { return data_; }
+        std::size_t size() const noexcept { return size_; }
+        ConstSpan<std::byte> bytes() const noexcept { return ConstSpan<std::byte>{ data_, size_ }; }
+
+        // 実際に OS のマッピングを使っているか（false = バッファ代用）
+        bool mapped() const noexcept { return mapped_; }
+
+    private:
+        FileMapping() = default;
+
+    private:
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool mapped_ = false;
+
+        void* fileHandle_ = nullptr; // Windows のみ
+        void* mapHandle_ = nullptr;  // Windows のみ
+        std::unique_ptr<std::byte[]> fallback_; // マッピング不可の環境用
+    };
+
+} // namespace Engine::Asset::Detail
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace Engine::Asset::Detail {
+
+    // FixedString：文字列リテラルをテンプレート引数に渡すための入れ物（"..."_aid / "..."_atype 用）
+    // - N は終端の '\0' を含む長さ
+    template <std::size_t N>
+    struct FixedString final {
+        char data[N]{};
+
+        consteval FixedString(const char (&s)[N]) noexcept {
+            for (std::size_t i = 0; i < N; ++i) data[i] = s[i];
+        }
+
+        constexpr std::string_view View() const noexcept { return std::string_view(data, N - 1); }
+    };
+
+} // namespace Engine::Asset::Detail
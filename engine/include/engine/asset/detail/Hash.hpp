@@ -22,8 +22,14 @@ namespace Engine::Asset::Detail  {
         return h;
     }
 
+    // 文字列版：定数式でも使える（void* を経由しない。値はバイト列版と同じ）
     constexpr Hash64 Fnv1a64(std::string_view sv) noexcept {
-        return Fnv1a64(sv.data(), sv.size());
+        Hash64 h = 14695981039346656037ull;
+        for (char c : sv) {
+            h ^= static_cast<Hash64>(static_cast<unsigned char>(c));
+            h *= 1099511628211ull;
+        }
+        return h;
     }
 
     constexpr Hash64 HashCombine(Hash64 a, Hash64 b) noexcept {
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "engine/asset/detail/FixedString.hpp"
+#include "engine/asset/detail/Hash.hpp"
+
+namespace Engine::Asset::Detail {
+
+    // NameTable：ハッシュ値 → 元の文字列 の intern 表（プロセス全体で共有）
+    // - AssetId / AssetType は 8 byte のハッシュだけを持ち、名前はここに置く
+    // - 一度登録した名前は消さない（Find が返す string_view はプロセス終了まで有効）
+    // - スレッドセーフ（登録は排他、参照は共有ロック）
+    class NameTable final {
+    public:
+        enum class InternResult : std::uint8_t {
+            Added,     // 新しく登録した
+            Existing,  // 同じ名前が登録済み
+            Collision, // 別の名前が同じハッシュで登録済み（登録済みの方を残す）
+        };
+
+        InternResult Intern(std::uint64_t key, std::string_view name);
+
+        // 未登録なら空
+        std::string_view Find(std::uint64_t key) const;
+
+        std::size_t Size() const;
+
+    private:
+        mutable std::shared_mutex mutex_;
+        std::unordered_map<std::uint64_t, std::string> names_;
+    };
+
+    // AssetId / AssetType それぞれの表
+    NameTable& AssetIdNames();
+    NameTable& AssetTypeNames();
+
+    // 文字列リテラル（"..."_aid / "..."_atype）の名前登録
+    // - literal 演算子は consteval なのでその場では登録できない
+    // - 代わりにこの static メンバを参照しておき、静的初期化のときに 1 回だけ登録する（使う側のコストは 0）
+    template <NameTable& (*Table)(), FixedString S>
+    struct LiteralName final {
+        static inline const bool registered = (Table().Intern(Fnv1a64(S.View()), S.View()), true);
+    };
+
+} // namespace Engine::Asset::Detail
+
+// 1：AssetId::FromString / AssetType::FromString で名前を NameTable に登録する（ログ・デバッガ向け）
+// 0：登録しない（AssetCatalog は設定に関わらず登録して衝突を検査する）
+// - inline 関数の中身が変わるので TU ごとに決めてはいけない（ODR 違反になる）
+// - engine ターゲットの PUBLIC compile definition として CMake で 1 か所だけ決める
+#ifndef ENGINE_ASSET_DEBUG_NAME
+    #error "ENGINE_ASSET_DEBUG_NAME is not defined: link the engine target (engine/CMakeLists.txt sets it)"
+#endif
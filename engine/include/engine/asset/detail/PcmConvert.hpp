@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine::Asset::Detail {
+
+    // 16bit サンプルのバイト順を入れ替えながらコピーする（src は境界揃え不要。src == dst の in-place も可）
+    // big-endian ホストでしか通らないので scalar のみ
+    void ByteSwap16(const std::uint8_t* src, std::int16_t* dst, std::size_t samples) noexcept;
+
+    // little-endian PCM16 をホストの int16 に変換する
+    // - little-endian ホストは memcpy、big-endian ホストは ByteSwap16
+    void Pcm16LeToNative(const std::uint8_t* src, std::int16_t* dst, std::size_t samples) noexcept;
+
+} // namespace Engine::Asset::Detail
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "engine/asset/detail/CpuFeatures.hpp"
+
+namespace Engine::Asset::Detail {
+
+    // PixelConvert：画素フォーマット変換カーネル
+    // - x86/x64 は SSSE3 / AVX2 の pshufb 版を実行時に選ぶ（CPU が非対応ならスカラー版）
+    // - それ以外のアーキテクチャはスカラー版のみ
+
+    // RGB24 -> RGBA32（alpha = 255）
+    // src は pixels*3 バイト、dst は pixels*4 バイト。重なってはいけない
+    void Rgb24ToRgba32(const std::uint8_t* src, std::uint8_t* dst, std::size_t pixels) noexcept;
+
+    // 実装を指定して呼ぶ（比較/テスト用。CPU が非対応なら使える範囲に落とす）
+    void Rgb24ToRgba32(const std::uint8_t* src, std::uint8_t* dst, std::size_t pixels, SimdLevel level) noexcept;
+
+} // namespace Engine::Asset::Detail
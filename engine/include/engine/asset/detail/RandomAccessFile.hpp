@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+
+namespace Engine::Asset::Detail {
+
+    // RandomAccessFile：オフセット指定で読む読み取り専用ファイル
+    // - POSIX: pread / Windows: ReadFile + OVERLAPPED（どちらもファイル位置を共有しないのでスレッドセーフ）
+    // - それ以外の環境は ifstream + mutex で代用する
+    class RandomAccessFile final {
+    public:
+        using AssetError = Base::Error<AssetErrorCode>;
+
+        RandomAccessFile();
+        ~RandomAccessFile();
+
+        RandomAccessFile(const RandomAccessFile&) = delete;
+        RandomAccessFile& operator=(const RandomAccessFile&) = delete;
+        RandomAccessFile(RandomAccessFile&& other) noexcept;
+        RandomAccessFile& operator=(RandomAccessFile&& other) noexcept;
+
+        Base::Result<void, AssetError> Open(std::string_view path);
+        void Close() noexcept;
+
+        bool IsOpen() const noexcept;
+        std::uint64_t Size() const noexcept { return size_; }
+        const std::string& Path() const noexcept { return path_; }
+
+        // offset から size バイトを dst へ読む（足りなければ SourceReadFailed）
+        Base::Result<void, AssetError> ReadAt(std::uint64_t offset, void* dst, std::size_t size) const;
+
+        // OS のハンドル（POSIX: fd / Windows: HANDLE）。無ければ -1
+        std::intptr_t NativeHandle() const noexcept { return handle_; }
+
+    private:
+        struct Fallback;
+
+        std::intptr_t handle_ = -1;
+        std::uint64_t size_ = 0;
+        std::string path_;
+        std::unique_ptr<Fallback> fallback_; // ifstream 代用時のみ
+    };
+
+} // namespace Engine::Asset::Detail
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "engine/asset/detail/ByteBlob.hpp"
+
+namespace Engine::Asset::Detail {
+
+    // StringHeapBytes：std::string が heap に確保している量（SSO に収まっていれば 0）
+    // - IAssetLoader::ResidentBytes の集計用
+    inline std::uint64_t StringHeapBytes(const std::string& s) noexcept {
+        const char* d = s.data();
+        const char* self = reinterpret_cast<const char*>(&s);
+        if (d >= self && d < self + sizeof(std::string)) return 0;
+        return s.capacity() + 1;
+    }
+
+    // BlobHeapBytes：ByteBlob の中身の量（借用ビューなら view の長さ、所有コピーなら確保量）
+    inline std::uint64_t BlobHeapBytes(const ByteBlob& b) noexcept {
+        return b.IsBorrowed() ? b.Size() : b.OwnedCapacity();
+    }
+
+} // namespace Engine::Asset::Detail
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Engine::Asset::Detail {
+
+    // WAV(RIFF/WAVE) ヘッダの走査（SoundLoader / SoundStreamLoader 共通）
+    // - 先頭から data チャンクのヘッダまでを読む。data の中身には触れない
+    // - data より前のチャンクは丸ごと揃ってから読む（途中なら NeedMore）
+
+    inline std::uint16_t ReadU16LE(const unsigned char* p) noexcept {
+        return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+    }
+    inline std::uint32_t ReadU32LE(const unsigned char* p) noexcept {
+        return static_cast<std::uint32_t>(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24));
+    }
+
+    enum class WavScan : std::uint8_t {
+        NeedMore,  // data チャンクのヘッダまで届いていない
+        Found,     // data チャンクのヘッダを見つけた（dataOffset / dataSize が有効）
+        NotWav,    // RIFF/WAVE ではない
+        BadFmt,    // fmt チャンクが短すぎる
+    };
+
+    struct WavHeader final {
+        bool haveFmt = false;
+        std::uint16_t audioFormat = 0;
+        std::uint16_t channels = 0;
+        std::uint32_t sampleRate = 0;
+        std::uint16_t bitsPerSample = 0;
+
+        std::size_t dataOffset = 0;  // data 本体の先頭（ファイル先頭から）
+        std::uint32_t dataSize = 0;  // ヘッダ上のサイズ（実ファイルが短いこともある）
+    };
+
+    inline WavScan ScanWavHeader(const unsigned char* p, std::size_t n, WavHeader& out) noexcept {
+        if (n < 12) return WavScan::NeedMore;
+        if (std::memcmp(p, "RIFF", 4) != 0 || std::memcmp(p + 8, "WAVE", 4) != 0) return WavScan::NotWav;
+
+        std::size_t off = 12;
+        while (off + 8 <= n) {
+            const unsigned char* ck = p + off;
+            const std::uint32_t ckSize = ReadU32LE(ck + 4);
+
+            if (std::memcmp(ck, "data", 4) == 0) {
+                out.dataOffset = off + 8;
+                out.dataSize = ckSize;
+                return WavScan::Found;
+            }
+
+            if (off + 8 + ckSize > n) break;
+            if (std::memcmp(ck, "fmt ", 4) == 0) {
+                if (ckSize < 16) return WavScan::BadFmt;
+                out.haveFmt = true;
+                out.audioFormat   = ReadU16LE(ck + 8 + 0);
+                out.channels      = ReadU16LE(ck + 8 + 2);
+                out.sampleRate    = ReadU32LE(ck + 8 + 4);
+                out.bitsPerSample = ReadU16LE(ck + 8 + 14);
+            }
+            // チャンクは word align（奇数なら+1）
+            off += 8 + ckSize + (ckSize & 1u);
+        }
+        return WavScan::NeedMore;
+    }
+
+    // 対応外の fmt ならエラーメッセージ（対応していれば nullptr）
+    inline const char* CheckWavPcm16(std::uint16_t audioFormat, std::uint16_t channels, std::uint16_t bitsPerSample) noexcept {
+        if (audioFormat != 1) return "WAV: only PCM supported";
+        if (channels == 0 || (channels != 1 && channels != 2)) return "WAV: only mono/stereo supported";
+        if (bitsPerSample != 16) return "WAV: only 16-bit supported";
+        return nullptr;
+    }
+
+} // namespace Engine::Asset::Detail
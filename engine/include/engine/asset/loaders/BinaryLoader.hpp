@@ -6,6 +6,7 @@
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/asset/detail/ByteBlob.hpp"
 #include "engine/asset/detail/Span.hpp"
 #include "engine/asset/loading/IAssetLoader.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
@@ -13,16 +14,28 @@
 namespace Engine::Asset::Loaders {
     using AssetError = Base::Error<AssetErrorCode>;
 
+    // 生バイト列
+    // - source のビューに owner があればそれを握って参照する（コピー無し）
+    //   既定の IAssetSource::ReadView も読んだバッファを owner にするので、pipeline 経由なら通常こちら
+    // - owner の無いビューや Load 直呼びは所有コピーを持つ
+    // - 保持形態は ByteBlob の中に隠してある。読み出しは Bytes() だけ
     struct BinaryAsset final {
-        std::vector<std::byte> bytes;
+        Detail::ByteBlob data;
+
+        Detail::ConstSpan<std::byte> Bytes() const noexcept { return data.Bytes(); }
     };
 
     class BinaryLoader final : public Loading::IAssetLoader {
     public:
         AssetType GetType() const noexcept override;
 
+        std::uint64_t ResidentBytes(const Core::AnyAsset& asset) const noexcept override;
+
         Base::Result<Core::AnyAsset, AssetError>
         Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+
+        Base::Result<Core::AnyAsset, AssetError>
+        LoadView(const Loading::SourceView& src, const Loading::LoadContext& ctx) override;
     };
 
 } // namespace Engine::Asset::Loaders
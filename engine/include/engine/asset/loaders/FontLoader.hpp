@@ -7,6 +7,7 @@
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/asset/detail/ByteBlob.hpp"
 #include "engine/asset/detail/Span.hpp"
 #include "engine/asset/loading/IAssetLoader.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
@@ -16,16 +17,24 @@ namespace Engine::Asset::Loaders {
 
 
     // フォントは decode せず “Blob” として保持（後段の font rasterizer が使う）
+    // - 保持のしかたは BinaryAsset と同じ（owner 付きビューは参照、それ以外は所有コピー。読み出しは Bytes()）
     struct FontAsset final {
-        std::vector<std::byte> bytes; // TTF/OTF
+        Detail::ByteBlob data; // TTF/OTF
+
+        Detail::ConstSpan<std::byte> Bytes() const noexcept { return data.Bytes(); }
     };
 
     class FontLoader final : public Loading::IAssetLoader {
     public:
         AssetType GetType() const noexcept override;
 
+        std::uint64_t ResidentBytes(const Core::AnyAsset& asset) const noexcept override;
+
         Base::Result<Core::AnyAsset, AssetError>
         Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+
+        Base::Result<Core::AnyAsset, AssetError>
+        LoadView(const Loading::SourceView& src, const Loading::LoadContext& ctx) override;
     };
 
 } // namespace Engine::Asset::Loaders
@@ -7,6 +7,7 @@
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/asset/detail/DefaultInitAllocator.hpp"
 #include "engine/asset/detail/Span.hpp"
 #include "engine/asset/loading/IAssetLoader.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
@@ -15,18 +16,52 @@ namespace Engine::Asset::Loaders {
     using AssetError = Base::Error<AssetErrorCode>;
 
     // 最小のサウンド表現（PCM16）
+    // - 通常は pcm16 に所有コピーを持つ
+    // - little-endian ホストで data チャンクが 2 byte 境界にあれば、source のバイト列を
+    //   keepAlive で握って view から直接参照する（コピー無し）
+    // - 読み出しは Samples() を使う（どちらの場合も同じように扱える）
     struct SoundAsset final {
         std::uint32_t sampleRate = 0;
         std::uint16_t channels = 0;
-        std::vector<std::int16_t> pcm16; // interleaved
+        // interleaved。resize で 0 埋めしない（decode が全サンプルを書くので不要）
+        std::vector<std::int16_t, Detail::DefaultInitAllocator<std::int16_t>> pcm16;
+        Detail::ConstSpan<std::int16_t> view{};
+        std::shared_ptr<const void> keepAlive{};
+
+        Detail::ConstSpan<std::int16_t> Samples() const noexcept {
+            return keepAlive ? view : Detail::ConstSpan<std::int16_t>{ pcm16.data(), pcm16.size() };
+        }
     };
 
     class SoundLoader final : public Loading::IAssetLoader {
     public:
+        struct Options {
+            // 条件が揃えば source のバイト列を参照する（false なら常にコピー）
+            bool aliasSourceBytes = true;
+        };
+
+        SoundLoader() = default;
+        explicit SoundLoader(Options opt) : opt_(opt) {}
+
         AssetType GetType() const noexcept override;
 
+        std::uint64_t ResidentBytes(const Core::AnyAsset& asset) const noexcept override;
+
         Base::Result<Core::AnyAsset, AssetError>
         Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+
+        // 寿命を握れるビューなら data チャンクを直接参照する
+        Base::Result<Core::AnyAsset, AssetError>
+        LoadView(const Loading::SourceView& src, const Loading::LoadContext& ctx) override;
+
+        // data チャンクに入ったら届いた分からサンプルへ変換する
+        bool SupportsStreaming() const noexcept override { return true; }
+
+        std::unique_ptr<Loading::IStreamDecoder>
+        BeginStream(const Loading::LoadContext& ctx, std::uint64_t totalBytes) override;
+
+    private:
+        Options opt_{};
     };
 
 } // namespace Engine::Asset::Loaders
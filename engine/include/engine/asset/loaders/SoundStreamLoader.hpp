@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/asset/AssetType.hpp"
+#include "engine/asset/core/AnyAsset.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/detail/Span.hpp"
+#include "engine/asset/loading/IAssetLoader.hpp"
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/asset/loading/LoadContext.hpp"
+
+namespace Engine::Asset::Loaders {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // ストリーミング再生用のサウンド（WAV PCM16）
+    // - ロード時はヘッダだけ読み、data チャンクの位置を覚える（サンプルは持たない）
+    // - 再生は SoundStreamReader を開いて少しずつ読む（常駐メモリは reader のリングバッファ分だけ）
+    // - source は asset / reader より長生きすること（AssetPipeline に渡す source と同じ前提）
+    struct StreamingSoundAsset final {
+        std::uint32_t sampleRate = 0;
+        std::uint16_t channels = 0;
+        std::uint64_t totalSamples = 0; // interleaved のサンプル数（フレーム数 * channels）
+
+        Loading::IAssetSource* source = nullptr;
+        std::string resolvedPath;
+        std::uint64_t dataOffset = 0;   // data 本体の先頭（ファイル先頭からのバイト位置）
+
+        // reader の既定（SoundStreamLoader::Options から）
+        std::size_t ringSamples = 0;
+        std::size_t readAheadSamples = 0;
+    };
+
+    // SoundStreamReader：1 再生（ボイス）分の読み出し位置とリングバッファ
+    // - Read はリングから渡し、残りが readAheadSamples を切ったらリングが埋まるまで先読みする
+    //   （I/O は毎回まとまった量になり、Read の大半はメモリコピーだけで済む）
+    // - 再生開始前に Prefetch しておけば最初の Read で I/O を待たない
+    // - source の OpenRange を最初の refill で 1 回だけ開き、再生が終わるまで使い回す
+    //   （refill ごとに open したり、圧縮 pak のエントリを展開し直したりしない）
+    // - スレッドセーフではない（1 reader を複数スレッドから同時に使わない）
+    class SoundStreamReader final {
+    public:
+        explicit SoundStreamReader(const StreamingSoundAsset& asset);
+        SoundStreamReader(const StreamingSoundAsset& asset, std::size_t ringSamples, std::size_t readAheadSamples);
+
+        // 最大 dst.size() サンプルを書き込む（戻り値：書けた数。0 なら終端）
+        Base::Result<std::size_t, AssetError> Read(Detail::Span<std::int16_t> dst);
+
+        // リングが埋まるまで読む
+        Base::Result<void, AssetError> Prefetch();
+
+        // 読み出し位置を移す（リングは捨てる。totalSamples を越える位置は終端扱い）
+        void Seek(std::uint64_t sampleIndex) noexcept;
+
+        std::uint64_t Position() const noexcept { return pos_; }
+        std::uint64_t TotalSamples() const noexcept { return total_; }
+        std::size_t Buffered() const noexcept { return size_; }
+        std::size_t Capacity() const noexcept { return ring_.size(); }
+        bool AtEnd() const noexcept { return pos_ >= total_; }
+
+    private:
+        Base::Result<void, AssetError> Fill_();
+
+        Loading::IAssetSource* source_ = nullptr;
+        std::unique_ptr<Loading::IRangeReader> range_; // 最初の Fill_ で開く
+        std::string path_;
+        std::uint64_t dataOffset_ = 0;
+        std::uint64_t total_ = 0;
+        std::size_t readAhead_ = 0;
+
+        std::vector<std::int16_t> ring_;
+        std::size_t head_ = 0;  // リング内の読み出し位置
+        std::size_t size_ = 0;  // リング内の有効サンプル数
+        std::uint64_t pos_ = 0; // head_ のサンプルが data 内の何番目か
+    };
+
+    // "sound_stream" 型の loader
+    // - 増分 decode で data チャンクのヘッダまで読んだら読み出しを打ち切る（本体は読まない）
+    // - 対応形式とエラーは SoundLoader と同じ（WAV PCM16 mono/stereo）
+    class SoundStreamLoader final : public Loading::IAssetLoader {
+    public:
+        struct Options {
+            // reader 1 つ分のリングバッファ（サンプル数）：既定 64Ki サンプル = 128 KiB
+            std::size_t ringSamples = 64 * 1024;
+            // リングの残りがこれを切ったら先読みする
+            std::size_t readAheadSamples = 16 * 1024;
+        };
+
+        explicit SoundStreamLoader(Loading::IAssetSource& source) : source_(source) {}
+        SoundStreamLoader(Loading::IAssetSource& source, Options opt) : source_(source), opt_(opt) {}
+
+        AssetType GetType() const noexcept override;
+
+        std::uint64_t ResidentBytes(const Core::AnyAsset& asset) const noexcept override;
+
+        Base::Result<Core::AnyAsset, AssetError>
+        Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+
+        bool SupportsStreaming() const noexcept override { return true; }
+
+        std::unique_ptr<Loading::IStreamDecoder>
+        BeginStream(const Loading::LoadContext& ctx, std::uint64_t totalBytes) override;
+
+    private:
+        Loading::IAssetSource& source_;
+        Options opt_{};
+    };
+
+} // namespace Engine::Asset::Loaders
@@ -21,6 +21,8 @@ namespace Engine::Asset::Loaders {
     public:
         AssetType GetType() const noexcept override;
 
+        std::uint64_t ResidentBytes(const Core::AnyAsset& asset) const noexcept override;
+
         Base::Result<Core::AnyAsset, AssetError>
         Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
     };
@@ -7,6 +7,7 @@
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/asset/detail/DefaultInitAllocator.hpp"
 #include "engine/asset/detail/Span.hpp"
 #include "engine/asset/loading/IAssetLoader.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
@@ -18,15 +19,25 @@ namespace Engine::Asset::Loaders {
     struct TextureAsset final {
         std::uint32_t width  = 0;
         std::uint32_t height = 0;
-        std::vector<std::uint8_t> rgba; // size = width*height*4
+        // size = width*height*4
+        // resize で 0 埋めしない（decode が全画素を書くので不要）
+        std::vector<std::uint8_t, Detail::DefaultInitAllocator<std::uint8_t>> rgba;
     };
 
     class TextureLoader final : public Loading::IAssetLoader {
     public:
         AssetType GetType() const noexcept override;
 
+        std::uint64_t ResidentBytes(const Core::AnyAsset& asset) const noexcept override;
+
         Base::Result<Core::AnyAsset, AssetError>
         Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) override;
+
+        // P6 はヘッダを読んだ後、届いた分から RGBA へ展開する（P3 はまとめて Load と同じ処理）
+        bool SupportsStreaming() const noexcept override { return true; }
+
+        std::unique_ptr<Loading::IStreamDecoder>
+        BeginStream(const Loading::LoadContext& ctx, std::uint64_t totalBytes) override;
     };
 
 } // namespace Engine::Asset::Loaders
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
 #include "engine/asset/AssetError.hpp"
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/asset/detail/Span.hpp"
 #include "engine/asset/loading/IAssetSource.hpp"
 #include "engine/asset/loading/LoaderRegistry.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
@@ -10,19 +15,72 @@
 namespace Engine::Asset::Loading {
     using AssetError = Base::Error<AssetErrorCode>;
 
+    // LoadReport：1回の Load で分かった計測値（任意で受け取る）
+    // - worker thread 上では statistics を触れないため、ここに入れて main thread へ持ち帰る
+    struct LoadReport final {
+        std::uint64_t bytesRead = 0;     // source から読んだバイト数
+        std::uint64_t decodedBytes = 0;  // decode 後の常駐サイズ（IAssetLoader::ResidentBytes。0 は不明）
+    };
+
     // AssetPipeline：
     // - 読む（IAssetSource）
     // - 変換する（IAssetLoader）
     // - 成功/失敗を Result で返す
+    //
+    // 増分 decode：loader が SupportsStreaming なら Load はチャンク単位で読みながら decode する
+    // （ファイル全体と decode 結果を同時に抱えない。LoadMany でもそういう ctx はバッチに入れずチャンク読みする）
+    // source が HasZeroCopyViews なら増分 decode せず LoadView に渡す（loader が直接参照できる）
+    //
+    // スレッド：Load は ctx.statistics == nullptr なら複数スレッドから同時に呼んでよい
+    // （IAssetSource / IAssetLoader 実装がスレッドセーフである前提）
     class AssetPipeline final {
     public:
+        struct Options final {
+            // 増分 decode（IAssetLoader::SupportsStreaming）で 1 回に流すバイト数
+            // 0 なら増分 decode を使わず、常にファイル全体を読んでから decode する
+            std::size_t streamChunkBytes = 256 * 1024;
+        };
+
         AssetPipeline(IAssetSource& source, LoaderRegistry& registry);
+        AssetPipeline(IAssetSource& source, LoaderRegistry& registry, Options opt);
+
+        void SetOptions(Options opt) { opt_ = opt; }
+        const Options& GetOptions() const noexcept { return opt_; }
+
+        Base::Result<Core::AnyAsset, AssetError> Load(const LoadContext& ctx, LoadReport* report = nullptr);
+
+        // LoadMany の完了通知：index は ctxs 内の位置（同時には呼ばれない）
+        using LoadCallback = std::function<void(std::size_t index,
+                                                Base::Result<Core::AnyAsset, AssetError>&& result,
+                                                const LoadReport& report)>;
+
+        // まとめてロードする：読み出しは IAssetSource::ReadMany で 1 バッチにし、
+        // 届いたものから decode する（I/O 待ちの間に先に届いた分の decode が進む）
+        // - 増分 decode の対象（Load がチャンク読みするもの）はバッチに入れず、その場でチャンク読みする
+        void LoadMany(Detail::ConstSpan<LoadContext> ctxs, const LoadCallback& onComplete);
+
+    private:
+        // 検証 + loader 取得（失敗は statistics 記録済み）
+        Base::Result<IAssetLoader*, AssetError> Prepare_(const LoadContext& ctx);
+
+        // Load / LoadMany がこの loader をチャンク読みで decode するか
+        bool UsesStream_(const IAssetLoader& loader) const noexcept;
+
+        // ReadChunks + IStreamDecoder で decode する（statistics 記録込み）
+        Base::Result<Core::AnyAsset, AssetError> LoadStream_(IAssetLoader& loader,
+                                                             const LoadContext& ctx,
+                                                             LoadReport* report);
 
-        Base::Result<Core::AnyAsset, AssetError> Load(const LoadContext& ctx);
+        // 読めた bytes を decode する（statistics 記録込み）
+        Base::Result<Core::AnyAsset, AssetError> Decode_(IAssetLoader& loader,
+                                                         Base::Result<SourceView, AssetError>&& viewR,
+                                                         const LoadContext& ctx,
+                                                         LoadReport* report);
 
     private:
         IAssetSource& source_;
         LoaderRegistry& registry_;
+        Options opt_{};
     };
 
 } // namespace Engine::Asset::Loading
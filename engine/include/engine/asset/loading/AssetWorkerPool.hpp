@@ -0,0 +1,88 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/AssetRequest.hpp"
+#include "engine/asset/AssetType.hpp"
+#include "engine/asset/core/AnyAsset.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/loading/AssetPipeline.hpp"
+#include "engine/asset/loading/LoadContext.hpp"
+
+namespace Engine::Asset::Loading {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // AssetWorkerPool：
+    // - AssetPipeline::Load（ReadAll + IAssetLoader::Load）を worker thread 上で実行する
+    // - SubmitBatch で投げた job 群は 1 つの worker が AssetPipeline::LoadMany でまとめて読む
+    // - 完了結果は内部に溜めておき、main thread が DrainCompleted で回収する
+    // - AssetRecord / AssetStorage には触らない（publish は AssetManager の Update で行う）
+    class AssetWorkerPool final {
+    public:
+        struct Job final {
+            LoadContext ctx;        // ctx.request / ctx.statistics は worker 側で差し替える
+            AssetRequest request;
+        };
+
+        struct Completion final {
+            AssetId id{};
+            AssetType type{};
+            std::string resolvedPath;
+            AssetRequest request;
+            LoadReport report{};
+            Base::Result<Core::AnyAsset, AssetError> result;
+        };
+
+    public:
+        AssetWorkerPool(AssetPipeline& pipeline, std::uint32_t threadCount);
+        ~AssetWorkerPool();
+
+        AssetWorkerPool(const AssetWorkerPool&) = delete;
+        AssetWorkerPool& operator=(const AssetWorkerPool&) = delete;
+
+        // main thread から投入する
+        void Submit(Job job);
+
+        // まとめて投入する（IAssetSource::ReadMany の 1 バッチになる）
+        void SubmitBatch(std::vector<Job> jobs);
+
+        // 完了分を out の末尾へ移す（main thread の同期点で呼ぶ）
+        std::size_t DrainCompleted(std::vector<Completion>& out);
+
+        // 投入済みの job がすべて完了するまで待つ（設定変更/終了処理用）
+        void WaitIdle();
+
+        std::size_t ThreadCount() const noexcept { return threads_.size(); }
+
+        // 投入済みで、まだ DrainCompleted されていない件数
+        std::size_t InFlight() const;
+
+    private:
+        void WorkerMain_();
+        void RunBatch_(std::vector<Job>& batch);
+
+    private:
+        AssetPipeline& pipeline_;
+        std::vector<std::thread> threads_;
+
+        mutable std::mutex mtx_;
+        std::condition_variable workCv_;
+        std::condition_variable idleCv_;
+
+        std::deque<std::vector<Job>> batches_;
+        std::vector<Completion> done_;
+        std::size_t running_ = 0;   // worker が実行中のバッチ数
+        std::size_t inFlight_ = 0;  // Submit - DrainCompleted
+        bool stopping_ = false;
+    };
+
+} // namespace Engine::Asset::Loading
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 
 #include "engine/asset/AssetError.hpp"
 #include "engine/base/Error.hpp"
@@ -8,6 +10,8 @@
 #include "engine/asset/core/AnyAsset.hpp"
 #include "engine/base/Result.hpp"
 #include "engine/asset/detail/Span.hpp"
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/asset/loading/IStreamDecoder.hpp"
 #include "engine/asset/loading/LoadContext.hpp"
 
 
@@ -27,6 +31,26 @@ namespace Engine::Asset::Loading {
         // bytes を decode/parse して AnyAsset を返す
         virtual Base::Result<Core::AnyAsset, AssetError>
         Load(Detail::ConstSpan<std::byte> bytes, const LoadContext& ctx) = 0;
+
+        // 借用ビュー版（AssetPipeline はこちらを呼ぶ）
+        // - src.owner を asset に保持すれば、bytes をコピーせずに参照し続けられる（Blob 系向け）
+        // - 既定は Load(bytes) に委譲（decode して別表現にする loader はこれで十分）
+        virtual Base::Result<Core::AnyAsset, AssetError>
+        LoadView(const SourceView& src, const LoadContext& ctx) {
+            return Load(src.bytes, ctx);
+        }
+
+        // この loader が作った asset が常駐させているバイト数（AssetManager の byte budget 用）
+        // - 所有バッファは capacity で数える。keepAlive で握った借用ビューもその asset が手放すまで残るので数える
+        // - 0 は「不明」（既定）。budget の集計には 0 として入る
+        virtual std::uint64_t ResidentBytes(const Core::AnyAsset& /*asset*/) const noexcept { return 0; }
+
+        // 増分 decode に対応するか（true なら AssetPipeline は IAssetSource::ReadChunks で流し込む）
+        virtual bool SupportsStreaming() const noexcept { return false; }
+
+        // 増分 decoder を作る（totalBytes：入力全体のサイズ。source が分からなければ 0）
+        virtual std::unique_ptr<IStreamDecoder>
+        BeginStream(const LoadContext& /*ctx*/, std::uint64_t /*totalBytes*/) { return nullptr; }
     };
 
 } // namespace Engine::Asset::Loading
@@ -1,13 +1,18 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "engine/asset/AssetError.hpp"
 #include "engine/base/Error.hpp"
 #include "engine/base/Result.hpp"
+#include "engine/asset/detail/Span.hpp"
 
 namespace Engine::Asset::Loading {
     using AssetError = Base::Error<AssetErrorCode>;
@@ -15,6 +20,44 @@ namespace Engine::Asset::Loading {
     // バイト列の所有バッファ（I/O結果）
     using ByteBuffer = std::vector<std::byte>;
 
+    // SourceView：借用バイト列 + その寿命を保持するオーナー
+    // - bytes は owner が生きている間だけ有効（mmap の mapping / 共有バッファなど）
+    // - Blob 系 loader は owner を asset 側に保持すればコピー無しで済む
+    struct SourceView final {
+        Detail::ConstSpan<std::byte> bytes{};
+        std::shared_ptr<const void> owner{};
+    };
+
+    // IRangeReader：1 つの入力を何度も部分読みするためのハンドル（IAssetSource::OpenRange が返す）
+    // - 開く処理（open / 展開 / 全体読み）は OpenRange の 1 回だけで、ReadAt は読むだけ
+    // - ReadAt の約束は IAssetSource::ReadRange と同じ（読めたバイト数。終端以降は 0）
+    // - スレッドセーフではない（1 ハンドルを複数スレッドから同時に使わない）
+    class IRangeReader {
+    public:
+        virtual ~IRangeReader() = default;
+
+        virtual Base::Result<std::size_t, AssetError>
+        ReadAt(std::uint64_t offset, Detail::Span<std::byte> dst) = 0;
+    };
+
+    // 借用ビューを握って切り出すだけの IRangeReader（OpenRange の既定）
+    class ViewRangeReader final : public IRangeReader {
+    public:
+        explicit ViewRangeReader(SourceView view) : view_(std::move(view)) {}
+
+        Base::Result<std::size_t, AssetError>
+        ReadAt(std::uint64_t offset, Detail::Span<std::byte> dst) override {
+            const auto bytes = view_.bytes;
+            if (offset >= bytes.size()) return Base::Result<std::size_t, AssetError>::Ok(std::size_t{ 0 });
+            const auto part = bytes.subspan(static_cast<std::size_t>(offset), dst.size());
+            std::copy(part.begin(), part.end(), dst.begin());
+            return Base::Result<std::size_t, AssetError>::Ok(part.size());
+        }
+
+    private:
+        SourceView view_;
+    };
+
     // IAssetSource（アイ・アセット・ソース）
     // - 実体の読み出し担当（filesystem / pak / zip / memory などの抽象）
     // - 変換（decode）はしない（Loaderの責務）
@@ -26,6 +69,87 @@ namespace Engine::Asset::Loading {
         virtual Base::Result<ByteBuffer, AssetError>
         ReadAll(std::string_view resolvedPath) = 0;
 
+        // 借用ビューで読む（AssetPipeline はこちらを使う）
+        // 既定：ReadAll の結果を共有バッファにしてそのまま貸す（コピーは増えない）
+        virtual Base::Result<SourceView, AssetError>
+        ReadView(std::string_view resolvedPath) {
+            auto r = ReadAll(resolvedPath);
+            if (!r) return Base::Result<SourceView, AssetError>::Err(std::move(r.error()));
+
+            auto buf = std::make_shared<const ByteBuffer>(std::move(r.value()));
+            SourceView v;
+            v.bytes = Detail::ConstSpan<std::byte>{ buf->data(), buf->size() };
+            v.owner = std::move(buf);
+            return Base::Result<SourceView, AssetError>::Ok(std::move(v));
+        }
+
+        // ReadMany の完了通知：index は paths 内の位置
+        using ReadCallback = std::function<void(std::size_t index, Base::Result<SourceView, AssetError>&& result)>;
+
+        // まとめて読む（io_uring 等で queue depth を稼ぐ実装向け）
+        // - 完了した順に onComplete を呼ぶ。呼ぶスレッドは実装依存だが、同時には呼ばない
+        // - 全件の onComplete が終わってから戻る
+        // 既定：ReadView を順に呼ぶだけ
+        virtual void ReadMany(Detail::ConstSpan<std::string_view> paths, const ReadCallback& onComplete) {
+            for (std::size_t i = 0; i < paths.size(); ++i) {
+                onComplete(i, ReadView(paths[i]));
+            }
+        }
+
+        // ReadChunks の受け取り：false を返すと読み出しを打ち切る
+        // totalBytes は入力全体のサイズ（分からなければ 0）。空ファイルでも 1 回（空チャンクで）呼ぶ
+        using ChunkCallback = std::function<bool(Detail::ConstSpan<std::byte> chunk, std::uint64_t totalBytes)>;
+
+        // 先頭から順に最大 chunkBytes ずつ渡す（増分 decoder 向け）
+        // 既定：ReadView して切り分けるだけ（メモリは減らない。減らせる source は override する）
+        virtual Base::Result<void, AssetError>
+        ReadChunks(std::string_view resolvedPath, std::size_t chunkBytes, const ChunkCallback& onChunk) {
+            auto r = ReadView(resolvedPath);
+            if (!r) return Base::Result<void, AssetError>::Err(std::move(r.error()));
+
+            const auto bytes = r.value().bytes;
+            if (chunkBytes == 0) chunkBytes = bytes.size();
+            std::size_t off = 0;
+            do {
+                const auto chunk = bytes.subspan(off, chunkBytes);
+                if (!onChunk(chunk, bytes.size())) break;
+                off += chunk.size();
+            } while (off < bytes.size());
+            return Base::Result<void, AssetError>::Ok();
+        }
+
+        // offset から dst.size() バイトまで読む（ストリーミング再生などの部分読み向け）
+        // - 戻り値は読めたバイト数。終端を越える分は読まない（offset が終端以降なら 0）
+        // - 実装はスレッドセーフであること（再生スレッドから呼ばれうる）
+        // - 1 回きりの部分読み向け。繰り返すなら OpenRange でハンドルを開く
+        // 既定：ReadView して写すだけ（毎回全体を読む。部分読みできる source は override する）
+        virtual Base::Result<std::size_t, AssetError>
+        ReadRange(std::string_view resolvedPath, std::uint64_t offset, Detail::Span<std::byte> dst) {
+            auto r = ReadView(resolvedPath);
+            if (!r) return Base::Result<std::size_t, AssetError>::Err(std::move(r.error()));
+
+            const auto bytes = r.value().bytes;
+            if (offset >= bytes.size()) return Base::Result<std::size_t, AssetError>::Ok(std::size_t{ 0 });
+            const auto part = bytes.subspan(static_cast<std::size_t>(offset), dst.size());
+            std::copy(part.begin(), part.end(), dst.begin());
+            return Base::Result<std::size_t, AssetError>::Ok(part.size());
+        }
+
+        // 部分読みのハンドルを開く（ストリーミング再生など、同じ入力を繰り返し ReadRange する側向け）
+        // - ReadRange を毎回呼ぶと open や展開を毎回やり直す source があるので、繰り返すならこちらを使う
+        // 既定：ReadView を 1 回だけ行い、そのビューを握って切り出す
+        virtual Base::Result<std::unique_ptr<IRangeReader>, AssetError>
+        OpenRange(std::string_view resolvedPath) {
+            auto r = ReadView(resolvedPath);
+            if (!r) return Base::Result<std::unique_ptr<IRangeReader>, AssetError>::Err(std::move(r.error()));
+            return Base::Result<std::unique_ptr<IRangeReader>, AssetError>::Ok(
+                std::make_unique<ViewRangeReader>(std::move(r.value())));
+        }
+
+        // ReadView が読み出しもコピーも伴わない（mmap 等）なら true
+        // - AssetPipeline は増分 decode より LoadView を優先する（loader がバイト列を直接参照できる）
+        virtual bool HasZeroCopyViews() const noexcept { return false; }
+
         // 任意：将来使うなら
         virtual bool Exists(std::string_view /*resolvedPath*/) { return true; }
     };
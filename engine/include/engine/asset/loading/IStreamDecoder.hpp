@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/base/Error.hpp"
+#include "engine/asset/core/AnyAsset.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/detail/Span.hpp"
+
+namespace Engine::Asset::Loading {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // IStreamDecoder（アイ・ストリーム・デコーダ）
+    // - IAssetLoader::BeginStream が返す、1 アセット分の増分 decoder
+    // - 届いた順に Feed し、最後に Finish で完成品を受け取る
+    // - ファイル全体を抱えずに decode できるので、ピークメモリ = 出力 + チャンク 1 つ分になる
+    class IStreamDecoder {
+    public:
+        virtual ~IStreamDecoder() = default;
+
+        // チャンク境界は任意（ピクセルやサンプルの途中で切れてもよい：decoder が持ち越す）
+        // エラーを返したら以降の Feed / Finish は呼ばれない
+        virtual Base::Result<void, AssetError> Feed(Detail::ConstSpan<std::byte> chunk) = 0;
+
+        // false を返すと AssetPipeline は以降の読み出しを打ち切って Finish を呼ぶ
+        // （ヘッダだけ読めば足りる decoder 向け。既定は最後まで読む）
+        virtual bool NeedsMoreInput() const noexcept { return true; }
+
+        // 入力終端
+        virtual Base::Result<Core::AnyAsset, AssetError> Finish() = 0;
+    };
+
+} // namespace Engine::Asset::Loading
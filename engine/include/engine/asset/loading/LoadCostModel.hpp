@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Engine::Asset::Loading {
+
+    // LoadCostModel：1件のロードに何 ns かかるかの見積もり（AssetManager の時間予算用）
+    // - cost(ns) = fixedNs + bytes * nsPerByte
+    // - 実測（bytes, elapsedNs）を Observe で渡すと指数移動平均で学習する
+    // - bytes が分からない asset は平均サイズで見積もる
+    class LoadCostModel final {
+    public:
+        struct Options final {
+            // 学習率（0..1）。大きいほど直近の実測に追従する
+            double smoothing = 0.2;
+
+            // 初期値（学習前の見積もり）
+            double initialFixedNs   = 50'000.0; // open/stat/loader 起動など
+            double initialNsPerByte = 2.0;      // ~500MB/s 相当
+            double initialAvgBytes  = 64.0 * 1024.0;
+
+            // これより小さい実測は per-byte の学習に使わない（固定費が支配的でノイズになる）
+            std::uint64_t minBytesForThroughput = 4 * 1024;
+        };
+
+    public:
+        LoadCostModel() : LoadCostModel(Options{}) {}
+        explicit LoadCostModel(Options opt)
+            : opt_(opt)
+            , fixedNs_(opt.initialFixedNs)
+            , nsPerByte_(opt.initialNsPerByte)
+            , avgBytes_(opt.initialAvgBytes) {}
+
+        const Options& GetOptions() const noexcept { return opt_; }
+
+        // bytes == 0 は「サイズ不明」扱い（平均サイズで見積もる）
+        std::uint64_t EstimateNs(std::uint64_t bytes) const noexcept {
+            const double b = (bytes != 0) ? static_cast<double>(bytes) : avgBytes_;
+            return static_cast<std::uint64_t>(fixedNs_ + b * nsPerByte_);
+        }
+
+        void Observe(std::uint64_t bytes, std::uint64_t elapsedNs) noexcept {
+            const double a = opt_.smoothing;
+            const double t = static_cast<double>(elapsedNs);
+            const double b = static_cast<double>(bytes);
+
+            avgBytes_ += a * (b - avgBytes_);
+
+            if (bytes >= opt_.minBytesForThroughput) {
+                // 固定費を差し引いた残りを per-byte に割り当てる
+                const double variable = (t > fixedNs_) ? (t - fixedNs_) : 0.0;
+                nsPerByte_ += a * (variable / b - nsPerByte_);
+            } else {
+                const double fixed = t - b * nsPerByte_;
+                fixedNs_ += a * (((fixed > 0.0) ? fixed : 0.0) - fixedNs_);
+            }
+            ++samples_;
+        }
+
+        double FixedNs() const noexcept { return fixedNs_; }
+        double NsPerByte() const noexcept { return nsPerByte_; }
+        double AverageBytes() const noexcept { return avgBytes_; }
+        std::uint64_t Samples() const noexcept { return samples_; }
+
+    private:
+        Options opt_{};
+        double fixedNs_ = 0.0;
+        double nsPerByte_ = 0.0;
+        double avgBytes_ = 0.0;
+        std::uint64_t samples_ = 0;
+    };
+
+} // namespace Engine::Asset::Loading
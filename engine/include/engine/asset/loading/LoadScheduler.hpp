@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/AssetRequest.hpp"
+
+namespace Engine::Asset::Loading {
+
+    // LoadScheduler：Async ロード待ちの優先度キュー（AssetManager 内部で使う）
+    // - AssetRequest::priority が大きいほど先に取り出す
+    // - 同じ id の再投入はマージする（優先度は高い方へ引き上げ、Reload 要求は上書き）
+    // - aging：agingFrames 待つごとに実効優先度 +1（低優先度が飢餓しない）
+    //
+    // 実効優先度 = priority + (now - enqueueFrame) / agingFrames は全要素で同じ速度で増えるため、
+    // 並び順は key = priority * agingFrames - enqueueFrame で固定でき、ヒープを毎フレーム作り直さなくて良い。
+    class LoadScheduler final {
+    public:
+        struct Options final {
+            // 0 なら aging 無し（純粋な優先度順、同順位は FIFO）
+            std::uint64_t agingFrames = 60;
+        };
+
+        struct Entry final {
+            AssetId id{};
+            AssetRequest req;
+            std::uint64_t enqueueFrame = 0;
+
+            // 並び順（内部用）
+            std::int64_t key = 0;
+            std::uint64_t seq = 0;
+        };
+
+    public:
+        LoadScheduler() = default;
+        explicit LoadScheduler(Options opt) : opt_(opt) {}
+
+        // aging 設定を変えた場合は key を再計算する
+        void SetOptions(Options opt);
+        const Options& GetOptions() const noexcept { return opt_; }
+
+        // 追加。既に待っている id ならマージして false を返す
+        bool Push(const AssetId& id, const AssetRequest& req, std::uint64_t nowFrame);
+
+        // 最優先の要素を取り出す（空なら false）
+        bool Pop(Entry& out);
+
+        // Pop した要素を元の順位のまま戻す（実行できなかった場合用）
+        void Restore(Entry e);
+
+        bool Erase(const AssetId& id);
+
+        bool Contains(const AssetId& id) const noexcept { return index_.find(id) != index_.end(); }
+        const Entry* Find(const AssetId& id) const noexcept;
+
+        std::size_t Size() const noexcept { return heap_.size(); }
+        bool Empty() const noexcept { return heap_.empty(); }
+        void Clear();
+
+    private:
+        std::int64_t KeyOf_(std::int32_t priority, std::uint64_t enqueueFrame) const noexcept;
+        static bool Before_(const Entry& a, const Entry& b) noexcept;
+
+        void SiftUp_(std::size_t i);
+        void SiftDown_(std::size_t i);
+        void Swap_(std::size_t a, std::size_t b);
+        void RemoveAt_(std::size_t i);
+
+    private:
+        Options opt_{};
+        std::vector<Entry> heap_;
+        std::unordered_map<AssetId, std::size_t> index_; // id -> heap_ の位置
+        std::uint64_t seq_ = 0;
+    };
+
+} // namespace Engine::Asset::Loading
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/asset/AssetId.hpp"
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/detail/Span.hpp"
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/asset/pak/PakFormat.hpp"
+
+namespace Engine::Asset::Pak {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // PakBuilder：アセット群を 1 つの pak にまとめる（tools/asset_packer から使う）
+    // - resolvedPath は実行時に IAssetSource::ReadAll へ渡されるパスと同じものを入れる
+    // - 同じ id / 同じ path の二重登録はエラー
+    // - ある id と別エントリの path が同じキーになる登録もエラー
+    class PakBuilder final {
+    public:
+        struct Options final {
+            std::uint32_t alignment = 16;           // エントリ先頭の境界（2 の累乗）
+            Compression compression = Compression::None; // Add で指定しない時の既定
+        };
+
+        PakBuilder() = default;
+        explicit PakBuilder(Options opt) : opt_(opt) {}
+
+        Base::Result<void, AssetError>
+        Add(const AssetId& id, std::string_view resolvedPath, Detail::ConstSpan<std::byte> bytes);
+
+        // エントリ単位で圧縮を指定（すでに圧縮済みの形式は None が良い）
+        Base::Result<void, AssetError>
+        Add(const AssetId& id, std::string_view resolvedPath, Detail::ConstSpan<std::byte> bytes, Compression compression);
+
+        std::size_t EntryCount() const noexcept { return items_.size(); }
+
+        Base::Result<Loading::ByteBuffer, AssetError> Build() const;
+        Base::Result<void, AssetError> WriteToFile(std::string_view path) const;
+
+    private:
+        struct Item final {
+            AssetId::ValueType idKey = 0;
+            std::uint64_t pathKey = 0;
+            std::string path; // エラー表示用
+            Compression compression = Compression::None;
+            std::uint64_t rawSize = 0;
+            std::vector<std::byte> stored;
+        };
+
+        Options opt_{};
+        std::vector<Item> items_;
+        std::unordered_set<std::uint64_t> idKeys_;
+        std::unordered_set<std::uint64_t> pathKeys_;
+    };
+
+} // namespace Engine::Asset::Pak
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/base/Error.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/detail/Span.hpp"
+
+namespace Engine::Asset::Pak {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // PakCompression：pak エントリ用の LZ 系ブロック圧縮（LZ4 ブロック形式相当）
+    // - 外部ライブラリ無しで、展開が速いことを優先（圧縮率は二の次）
+    // - 展開は入力を信用しない（範囲外参照は DecodeFailed）
+
+    // 圧縮する。縮まなかった場合は空を返す（呼び出し側は無圧縮で格納する）
+    std::vector<std::byte> CompressLz(Detail::ConstSpan<std::byte> src);
+
+    // dst.size() ちょうどに展開できなければエラー
+    Base::Result<void, AssetError> DecompressLz(Detail::ConstSpan<std::byte> src, Detail::Span<std::byte> dst);
+
+} // namespace Engine::Asset::Pak
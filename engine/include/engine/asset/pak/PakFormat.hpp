@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "engine/asset/detail/Hash.hpp"
+
+namespace Engine::Asset::Pak {
+
+    // pak ファイル形式（すべてリトルエンディアン）
+    //
+    //   [Header 64B][entry data ...（alignment 境界に配置）][TOC]
+    //
+    //   TOC = Entry[entryCount] + Slot[slotCount]
+    //   - Slot はオープンアドレス（線形探索）のハッシュ表。slotCount は 2 の累乗
+    //   - 1 エントリにつき AssetId の値と resolvedPath のハッシュの 2 キーを登録する
+    //   - どちらで引いても O(1) で Entry に届き、データは 1 回の pread で読める
+
+    inline constexpr char          kMagic[4]       = { 'O', 'T', 'P', 'K' };
+    inline constexpr std::uint32_t kVersion        = 1;
+    inline constexpr std::size_t   kHeaderSize     = 64;
+    inline constexpr std::size_t   kEntrySize      = 48;
+    inline constexpr std::size_t   kSlotSize       = 16;
+    inline constexpr std::uint32_t kEmptySlot      = 0xFFFFFFFFu;
+
+    enum class Compression : std::uint32_t {
+        None = 0,
+        Lz   = 1, // PakCompression の LZ 系ブロック圧縮
+    };
+
+    struct Header final {
+        std::uint32_t version = kVersion;
+        std::uint32_t entryCount = 0;
+        std::uint32_t slotCount = 0;
+        std::uint32_t alignment = 16;
+        std::uint64_t tocOffset = 0;
+        std::uint64_t tocSize = 0;
+    };
+
+    struct Entry final {
+        std::uint64_t idKey = 0;    // AssetId::value
+        std::uint64_t pathKey = 0;  // PathKey(resolvedPath)
+        std::uint64_t offset = 0;   // ファイル先頭からのバイト位置
+        std::uint64_t storedSize = 0;
+        std::uint64_t rawSize = 0;
+        Compression compression = Compression::None;
+        std::uint32_t flags = 0;
+    };
+
+    struct Slot final {
+        std::uint64_t key = 0;
+        std::uint32_t entryIndex = kEmptySlot;
+    };
+
+    // resolvedPath のキー（'\\' は '/' とみなす：Windows でビルドした pak も同じキーになる）
+    inline Detail::Hash64 PathKey(std::string_view path) noexcept {
+        constexpr Detail::Hash64 kOffsetBasis = 14695981039346656037ull;
+        constexpr Detail::Hash64 kPrime       = 1099511628211ull;
+
+        Detail::Hash64 h = kOffsetBasis;
+        for (char c : path) {
+            const unsigned char u = static_cast<unsigned char>(c == '\\' ? '/' : c);
+            h ^= static_cast<Detail::Hash64>(u);
+            h *= kPrime;
+        }
+        return h;
+    }
+
+    // キー -> 初期スロット（キーは FNV 済みなので下位ビットをそのまま使う）
+    inline std::uint32_t SlotOf(std::uint64_t key, std::uint32_t mask) noexcept {
+        return static_cast<std::uint32_t>((key ^ (key >> 32)) & mask);
+    }
+
+    // ---- LE 読み書き ----
+    inline void StoreU32(std::byte* p, std::uint32_t v) noexcept {
+        for (int i = 0; i < 4; ++i) p[i] = static_cast<std::byte>((v >> (8 * i)) & 0xFFu);
+    }
+    inline void StoreU64(std::byte* p, std::uint64_t v) noexcept {
+        for (int i = 0; i < 8; ++i) p[i] = static_cast<std::byte>((v >> (8 * i)) & 0xFFu);
+    }
+    inline std::uint32_t LoadU32(const std::byte* p) noexcept {
+        std::uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) v |= static_cast<std::uint32_t>(p[i]) << (8 * i);
+        return v;
+    }
+    inline std::uint64_t LoadU64(const std::byte* p) noexcept {
+        std::uint64_t v = 0;
+        for (int i = 0; i < 8; ++i) v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+        return v;
+    }
+
+    // 予約領域は 0。ローカルに組んでから 1 回で書き出す
+    inline void WriteHeader(std::byte* p, const Header& h) noexcept {
+        std::array<std::byte, kHeaderSize> b{};
+        std::memcpy(b.data(), kMagic, 4);
+        StoreU32(b.data() + 4, h.version);
+        StoreU32(b.data() + 8, h.entryCount);
+        StoreU32(b.data() + 12, h.slotCount);
+        StoreU32(b.data() + 16, h.alignment);
+        StoreU64(b.data() + 24, h.tocOffset);
+        StoreU64(b.data() + 32, h.tocSize);
+        std::memcpy(p, b.data(), b.size());
+    }
+
+    // magic が違えば false
+    inline bool ReadHeader(const std::byte* p, Header& out) noexcept {
+        if (std::memcmp(p, kMagic, 4) != 0) return false;
+        out.version = LoadU32(p + 4);
+        out.entryCount = LoadU32(p + 8);
+        out.slotCount = LoadU32(p + 12);
+        out.alignment = LoadU32(p + 16);
+        out.tocOffset = LoadU64(p + 24);
+        out.tocSize = LoadU64(p + 32);
+        return true;
+    }
+
+    inline void WriteEntry(std::byte* p, const Entry& e) noexcept {
+        StoreU64(p + 0, e.idKey);
+        StoreU64(p + 8, e.pathKey);
+        StoreU64(p + 16, e.offset);
+        StoreU64(p + 24, e.storedSize);
+        StoreU64(p + 32, e.rawSize);
+        StoreU32(p + 40, static_cast<std::uint32_t>(e.compression));
+        StoreU32(p + 44, e.flags);
+    }
+
+    inline Entry ReadEntry(const std::byte* p) noexcept {
+        Entry e;
+        e.idKey = LoadU64(p + 0);
+        e.pathKey = LoadU64(p + 8);
+        e.offset = LoadU64(p + 16);
+        e.storedSize = LoadU64(p + 24);
+        e.rawSize = LoadU64(p + 32);
+        e.compression = static_cast<Compression>(LoadU32(p + 40));
+        e.flags = LoadU32(p + 44);
+        return e;
+    }
+
+    inline void WriteSlot(std::byte* p, const Slot& s) noexcept {
+        StoreU64(p + 0, s.key);
+        StoreU32(p + 8, s.entryIndex);
+        StoreU32(p + 12, 0);
+    }
+
+    inline Slot ReadSlot(const std::byte* p) noexcept {
+        Slot s;
+        s.key = LoadU64(p + 0);
+        s.entryIndex = LoadU32(p + 8);
+        return s;
+    }
+
+} // namespace Engine::Asset::Pak
@@ -45,17 +45,18 @@ namespace Engine::Asset::Resolver {
         // - 出力: "<assetsRoot>/textures/player.png" (正規化済み)
         Base::Result<std::string, AssetError> Resolve(std::string_view catalogPath) const;
 
+        // Resolve と同じ結果を out の末尾へ書く（out は呼び出し側が使い回すバッファ / arena）
+        // - 途中の文字列を作らず 1 回なめるだけ。out の容量が足りていれば確保は 0
+        //   （足りる目安：assetsRoot.size() + catalogPath.size() + 1）
+        // - 成功：追記した部分を返す（out が次に伸びるまで有効）
+        // - 失敗：out は呼び出し前の長さに戻す
+        Base::Result<std::string_view, AssetError> ResolveAppend(std::string_view catalogPath, std::string& out) const;
+
         // 便利：正規化のみ（単体テストにも使える）
         static std::string NormalizePath(std::string_view path,
                                          bool normalizeSeparators = true,
                                          bool squashSlashes = true);
 
-    private:
-        static bool IsAbsolutePath(std::string_view p);
-        static std::string StripScheme(std::string_view p, bool& stripped);
-        static std::string JoinRootAndRelative(std::string_view root, std::string_view rel);
-        static std::string RemoveDotSegments(std::string_view path, bool& escapedAboveRoot);
-
     private:
         Options opt_{};
     };
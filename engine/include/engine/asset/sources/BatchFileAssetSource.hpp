@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/asset/sources/FileAssetSource.hpp"
+
+namespace Engine::Asset::Sources {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // BatchFileAssetSource：ReadMany をまとめて発行するルーズファイル source
+    // - Linux：io_uring（liburing 無しで syscall 直叩き）で最大 queueDepth 件の read を同時に投げる
+    // - io_uring が使えない環境（非 Linux / カーネルや seccomp で拒否）は pread スレッドプールで代用
+    // - 単発の ReadAll / ReadView は FileAssetSource と同じ
+    // - ReadMany は複数スレッドから同時に呼んでよい（ring は呼び出しごとに貸し出す）
+    class BatchFileAssetSource final : public FileAssetSource {
+    public:
+        struct Options final {
+            std::uint32_t queueDepth = 32;     // 同時に投げる read の上限
+            std::uint32_t fallbackThreads = 4; // 代用 pread スレッド数（0 なら呼び出しスレッドで順に読む）
+            bool disableUring = false;         // io_uring を使わない（比較/テスト用）
+        };
+
+        enum class Backend : std::uint8_t {
+            IoUring,
+            ThreadPool,
+        };
+
+        BatchFileAssetSource();
+        explicit BatchFileAssetSource(Options opt);
+        ~BatchFileAssetSource() override;
+
+        BatchFileAssetSource(const BatchFileAssetSource&) = delete;
+        BatchFileAssetSource& operator=(const BatchFileAssetSource&) = delete;
+
+        void ReadMany(Detail::ConstSpan<std::string_view> paths, const ReadCallback& onComplete) override;
+
+        Backend GetBackend() const noexcept;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+} // namespace Engine::Asset::Sources
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/loading/IAssetSource.hpp"
+
+namespace Engine::Asset::Sources {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // FileAssetSource：ルーズファイル（resolvedPath = ファイルパス）を丸ごと読む最小実装
+    // - 1回のロードで open/stat/read を行う
+    // - スレッドセーフ（状態を持たない）
+    class FileAssetSource : public Loading::IAssetSource {
+    public:
+        Base::Result<Loading::ByteBuffer, AssetError>
+        ReadAll(std::string_view resolvedPath) override;
+
+        // pread で chunkBytes ずつ読む（バッファは 1 つを使い回す）
+        // 順読みなので OS の先読みが効き、decode している間に次のチャンクが用意される
+        Base::Result<void, AssetError>
+        ReadChunks(std::string_view resolvedPath, std::size_t chunkBytes, const ChunkCallback& onChunk) override;
+
+        // 1 回の open + pread
+        Base::Result<std::size_t, AssetError>
+        ReadRange(std::string_view resolvedPath, std::uint64_t offset, Detail::Span<std::byte> dst) override;
+
+        // ファイルを 1 回だけ開き、以後は pread だけ（ストリーミング再生の refill 向け）
+        Base::Result<std::unique_ptr<Loading::IRangeReader>, AssetError>
+        OpenRange(std::string_view resolvedPath) override;
+
+        bool Exists(std::string_view resolvedPath) override;
+    };
+
+} // namespace Engine::Asset::Sources
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string_view>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/asset/sources/FileAssetSource.hpp"
+
+namespace Engine::Asset::Sources {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // MappedFileAssetSource：ルーズファイルを mmap して借用ビューで渡す
+    // - ReadView は Detail::FileMapping を owner にした SourceView を返す（コピー無し）
+    // - Blob 系（Binary/Font）は mapping を asset に持たせるので、ロード中のコピーが 0 回になる
+    // - Sound など増分 decode 対応の loader にも LoadView で渡す（PCM を mapping から直接参照できる）
+    // - ReadAll（所有バッファが必要な呼び出し側向け）は mapping からコピーする
+    //
+    // 注意：asset は mapping をそのまま参照し続ける（コピーしない）
+    // - ロード後にファイルが切り詰められたり、その場で書き換えられたりすると、
+    //   参照している asset を読んだ時点で SIGBUS（Windows では in-page error）になるか、中身が黙って変わる
+    // - ホットリロードで監視するファイル（エディタやツールがその場で上書きする）には使わない。
+    //   差し替えは別名に書いてから rename する（古い mapping は旧 inode を指したまま有効）
+    class MappedFileAssetSource final : public FileAssetSource {
+    public:
+        Base::Result<Loading::ByteBuffer, AssetError>
+        ReadAll(std::string_view resolvedPath) override;
+
+        Base::Result<Loading::SourceView, AssetError>
+        ReadView(std::string_view resolvedPath) override;
+
+        bool HasZeroCopyViews() const noexcept override { return true; }
+    };
+
+} // namespace Engine::Asset::Sources
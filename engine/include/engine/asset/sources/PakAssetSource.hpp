@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "engine/asset/AssetError.hpp"
+#include "engine/asset/AssetId.hpp"
+#include "engine/base/Result.hpp"
+#include "engine/asset/detail/RandomAccessFile.hpp"
+#include "engine/asset/loading/IAssetSource.hpp"
+#include "engine/asset/pak/PakFormat.hpp"
+
+namespace Engine::Asset::Sources {
+    using AssetError = Base::Error<AssetErrorCode>;
+
+    // PakAssetSource：pak アーカイブから読む IAssetSource
+    // - Open 時に TOC だけ読む（pak ファイルは開きっぱなし）
+    // - resolvedPath / AssetId どちらも O(1) のハッシュ表引き + 1 回の pread
+    // - Open 後は読み取り専用なのでワーカースレッドから並行に呼んでよい
+    class PakAssetSource final : public Loading::IAssetSource {
+    public:
+        Base::Result<void, AssetError> Open(std::string_view pakPath);
+
+        Base::Result<Loading::ByteBuffer, AssetError>
+        ReadAll(std::string_view resolvedPath) override;
+
+        Base::Result<Loading::ByteBuffer, AssetError> ReadById(const AssetId& id);
+
+        // 無圧縮エントリは pread で chunkBytes ずつ読む（圧縮エントリは展開後を切り分ける）
+        Base::Result<void, AssetError>
+        ReadChunks(std::string_view resolvedPath, std::size_t chunkBytes, const ChunkCallback& onChunk) override;
+
+        // 無圧縮エントリは 1 回の pread（圧縮エントリは毎回展開してから切り出す）
+        Base::Result<std::size_t, AssetError>
+        ReadRange(std::string_view resolvedPath, std::uint64_t offset, Detail::Span<std::byte> dst) override;
+
+        // 無圧縮エントリは開いている pak への pread だけ。圧縮エントリは開く時に 1 回だけ展開して持つ
+        // - 返した reader は この source より先に破棄すること
+        Base::Result<std::unique_ptr<Loading::IRangeReader>, AssetError>
+        OpenRange(std::string_view resolvedPath) override;
+
+        bool Exists(std::string_view resolvedPath) override;
+        bool Contains(const AssetId& id) const noexcept;
+
+        std::size_t EntryCount() const noexcept { return entries_.size(); }
+
+    private:
+        // 同じスロット表から id キー / path キーを引き分ける（キーの種類も照合する）
+        const Pak::Entry* FindById_(std::uint64_t key) const noexcept;
+        const Pak::Entry* FindByPath_(std::uint64_t key) const noexcept;
+        Base::Result<Loading::ByteBuffer, AssetError> ReadEntry_(const Pak::Entry& e, std::string_view what) const;
+
+        Detail::RandomAccessFile file_;
+        std::vector<Pak::Entry> entries_;
+        std::vector<Pak::Slot> slots_;
+        std::uint32_t mask_ = 0;
+    };
+
+} // namespace Engine::Asset::Sources
@@ -1,30 +1,150 @@
 #include "engine/asset/AssetCatalog.hpp"
 
+#include <algorithm>
 #include <fstream>
-#include <sstream>
+#include <thread>
 
 #include "engine/asset/AssetType.hpp"
 #include "engine/asset/catalog/CatalogParser.hpp"
+#include "engine/asset/catalog/CompiledCatalogFormat.hpp"
+#include "engine/asset/detail/FileMapping.hpp"
 #include "engine/asset/resolver/AssetPathResolver.hpp"
 
 namespace Engine::Asset {
 
     void AssetCatalog::Clear() {
+        std::lock_guard lock(materializeMutex_);
         map_.clear();
+        compiled_.reset();
+        seeds_ = nullptr;
+        entries_ = nullptr;
+        strings_ = nullptr;
+        stringsSize_ = 0;
+        salt_ = 0;
+        entryCount_ = 0;
+        bucketCount_ = 0;
     }
 
-    const Catalog::CatalogEntry* AssetCatalog::Find(const AssetId& id) const noexcept {
+    std::size_t AssetCatalog::Size() const noexcept {
+        return compiled_ ? entryCount_ : map_.size();
+    }
+
+    const Catalog::CatalogEntry* AssetCatalog::Find(const AssetId& id) const {
+        if (compiled_) {
+            Catalog::CatalogEntryView v;
+            return FindCompiled_(id, v) ? Materialize_(v) : nullptr;
+        }
         auto it = map_.find(id);
         return (it == map_.end()) ? nullptr : &it->second;
     }
 
+    bool AssetCatalog::FindView(const AssetId& id, Catalog::CatalogEntryView& out) const noexcept {
+        if (compiled_) return FindCompiled_(id, out);
+
+        auto it = map_.find(id);
+        if (it == map_.end()) return false;
+        out.id = it->second.id;
+        out.type = it->second.type;
+        out.sourcePath = it->second.sourcePath;
+        out.resolvedPath = it->second.resolvedPath;
+        return true;
+    }
+
     std::vector<const Catalog::CatalogEntry*> AssetCatalog::Entries() const {
         std::vector<const Catalog::CatalogEntry*> out;
+        if (compiled_) {
+            // slot 順に全件を写す
+            out.reserve(entryCount_);
+            for (std::uint32_t i = 0; i < entryCount_; ++i) {
+                const auto e = Catalog::Compiled::ReadEntry(entries_ + std::size_t{ i } * Catalog::Compiled::kEntrySize);
+                Catalog::CatalogEntryView v;
+                if (FindCompiled_(AssetId(e.idKey), v)) out.push_back(Materialize_(v));
+            }
+            return out;
+        }
         out.reserve(map_.size());
         for (auto& kv : map_) out.push_back(&kv.second);
         return out;
     }
 
+    bool AssetCatalog::FindCompiled_(const AssetId& id, Catalog::CatalogEntryView& out) const noexcept {
+        using namespace Catalog::Compiled;
+        if (entryCount_ == 0) return false;
+
+        const std::uint32_t seed = LoadU32(seeds_ + std::size_t{ BucketOf(id.value, salt_, bucketCount_) } * kSeedSize);
+        const std::uint32_t slot = (seed & kDirectSlot) ? (seed & ~kDirectSlot) : SlotOf(id.value, salt_, seed, entryCount_);
+        if (slot >= entryCount_) return false;
+
+        // 表に無い id も何かの slot に落ちる：id を比べて確かめる
+        const Entry e = ReadEntry(entries_ + std::size_t{ slot } * kEntrySize);
+        if (e.idKey != id.value) return false;
+
+        // 壊れたファイルで pool の外を指していたら無いことにする
+        if (std::uint64_t{ e.sourceOffset } + e.sourceLength > stringsSize_ ||
+            std::uint64_t{ e.resolvedOffset } + e.resolvedLength > stringsSize_) {
+            return false;
+        }
+
+        out.id = id;
+        out.type = AssetType(e.typeKey);
+        out.sourcePath = std::string_view(strings_ + e.sourceOffset, e.sourceLength);
+        out.resolvedPath = std::string_view(strings_ + e.resolvedOffset, e.resolvedLength);
+        return true;
+    }
+
+    const Catalog::CatalogEntry* AssetCatalog::Materialize_(const Catalog::CatalogEntryView& v) const {
+        std::lock_guard lock(materializeMutex_);
+        auto [it, inserted] = map_.try_emplace(v.id);
+        if (inserted) {
+            it->second.id = v.id;
+            it->second.type = v.type;
+            it->second.sourcePath = std::string(v.sourcePath);
+            it->second.resolvedPath = std::string(v.resolvedPath);
+        }
+        return &it->second;
+    }
+
+    Base::Result<void, AssetError> AssetCatalog::LoadCompiled(std::string_view compiledCatalogPath) {
+        using namespace Catalog::Compiled;
+        Clear();
+
+        auto bad = [&](const char* msg) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::ParseFailed, msg, std::string(compiledCatalogPath)));
+        };
+
+        auto opened = Detail::FileMapping::Open(compiledCatalogPath);
+        if (!opened) return Base::Result<void, AssetError>::Err(std::move(opened.error()));
+        auto mapping = std::move(opened.value());
+
+        const std::byte* base = mapping->data();
+        const std::uint64_t size = mapping->size();
+        if (size < kHeaderSize) return bad("AssetCatalog: compiled catalog too small");
+
+        Header h;
+        if (!ReadHeader(base, h)) return bad("AssetCatalog: compiled catalog bad magic");
+        if (h.version != kVersion) return bad("AssetCatalog: compiled catalog version mismatch");
+        if ((h.entryCount == 0) != (h.bucketCount == 0)) return bad("AssetCatalog: compiled catalog broken header");
+
+        // 各領域がファイル内に収まっているか（オフセットの足し算が溢れないよう先に比べる）
+        auto fits = [&](std::uint64_t off, std::uint64_t bytes) { return off <= size && bytes <= size - off; };
+        if (!fits(h.seedsOffset, std::uint64_t{ h.bucketCount } * kSeedSize) ||
+            !fits(h.entriesOffset, std::uint64_t{ h.entryCount } * kEntrySize) ||
+            !fits(h.stringsOffset, h.stringsSize)) {
+            return bad("AssetCatalog: compiled catalog truncated");
+        }
+
+        seeds_ = base + h.seedsOffset;
+        entries_ = base + h.entriesOffset;
+        strings_ = reinterpret_cast<const char*>(base + h.stringsOffset);
+        stringsSize_ = h.stringsSize;
+        salt_ = h.salt;
+        entryCount_ = h.entryCount;
+        bucketCount_ = h.bucketCount;
+        compiled_ = std::move(mapping);
+        return Base::Result<void, AssetError>::Ok();
+    }
+
     static Base::Result<std::string, AssetError>
     ReadAllText(std::string_view path) {
         std::ifstream ifs(std::string(path), std::ios::in | std::ios::binary);
@@ -32,9 +152,16 @@ namespace Engine::Asset {
             return Base::Result<std::string, AssetError>::Err(
                 AssetError::Make(AssetErrorCode::SourceReadFailed, "AssetCatalog: cannot open catalog file", std::string(path)));
         }
-        std::ostringstream ss;
-        ss << ifs.rdbuf();
-        return Base::Result<std::string, AssetError>::Ok(ss.str());
+        // サイズを先に取って 1 回で読む（stringstream 経由の二重コピーを避ける）
+        ifs.seekg(0, std::ios::end);
+        const std::streamoff size = ifs.tellg();
+        ifs.seekg(0, std::ios::beg);
+        std::string text(size > 0 ? static_cast<std::size_t>(size) : 0, '\0');
+        if (size > 0 && !ifs.read(text.data(), size)) {
+            return Base::Result<std::string, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "AssetCatalog: cannot read catalog file", std::string(path)));
+        }
+        return Base::Result<std::string, AssetError>::Ok(std::move(text));
     }
 
     Base::Result<void, AssetError>
@@ -42,48 +169,188 @@ namespace Engine::Asset {
                                Catalog::CatalogParser& parser,
                                const Resolver::AssetPathResolver& resolver) {
         Clear();
+        return BuildFromFile_(catalogJsonPath, parser, resolver, map_);
+    }
+
+    Base::Result<Catalog::CatalogDiff, AssetError>
+    AssetCatalog::ReloadFromFile(std::string_view catalogJsonPath,
+                                 Catalog::CatalogParser& parser,
+                                 const Resolver::AssetPathResolver& resolver) {
+        // 別の表に組み立ててから比べる（失敗しても今の内容は残る）
+        EntryMap fresh;
+        auto built = BuildFromFile_(catalogJsonPath, parser, resolver, fresh);
+        if (!built) return Base::Result<Catalog::CatalogDiff, AssetError>::Err(std::move(built.error()));
 
+        Catalog::CatalogDiff diff;
+        if (compiled_) {
+            // バイナリ catalog から：FindView で比べ、中身は丸ごと差し替える
+            for (const auto& [id, e] : fresh) {
+                Catalog::CatalogEntryView v;
+                if (!FindCompiled_(id, v)) {
+                    diff.added.push_back(id);
+                } else if (v.type != e.type || v.resolvedPath != e.resolvedPath) {
+                    diff.changed.push_back(id);
+                }
+            }
+            for (std::uint32_t i = 0; i < entryCount_; ++i) {
+                const auto e = Catalog::Compiled::ReadEntry(entries_ + std::size_t{ i } * Catalog::Compiled::kEntrySize);
+                if (fresh.find(AssetId(e.idKey)) == fresh.end()) diff.removed.push_back(AssetId(e.idKey));
+            }
+            Clear();
+            map_ = std::move(fresh);
+        } else {
+            // JSON から：map_ をその場で直す
+            for (auto it = map_.begin(); it != map_.end();) {
+                if (fresh.find(it->first) == fresh.end()) {
+                    diff.removed.push_back(it->first);
+                    it = map_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            for (auto& [id, e] : fresh) {
+                auto [it, inserted] = map_.try_emplace(id);
+                Catalog::CatalogEntry& cur = it->second;
+                if (inserted) {
+                    cur = std::move(e);
+                    diff.added.push_back(id);
+                } else if (cur.type != e.type || cur.resolvedPath != e.resolvedPath) {
+                    cur = std::move(e);
+                    diff.changed.push_back(id);
+                } else if (cur.sourcePath != e.sourcePath) {
+                    // 書き方が変わっただけ（"a/./b" → "a/b" など）：読み直す必要は無い
+                    cur.sourcePath = std::move(e.sourcePath);
+                }
+            }
+        }
+
+        auto byValue = [](const AssetId& a, const AssetId& b) { return a.value < b.value; };
+        std::sort(diff.added.begin(), diff.added.end(), byValue);
+        std::sort(diff.removed.begin(), diff.removed.end(), byValue);
+        std::sort(diff.changed.begin(), diff.changed.end(), byValue);
+        return Base::Result<Catalog::CatalogDiff, AssetError>::Ok(std::move(diff));
+    }
+
+    Base::Result<void, AssetError>
+    AssetCatalog::BuildFromFile_(std::string_view catalogJsonPath,
+                                 Catalog::CatalogParser& parser,
+                                 const Resolver::AssetPathResolver& resolver,
+                                 EntryMap& out) const {
         auto textR = ReadAllText(catalogJsonPath);
         if (!textR) return Base::Result<void, AssetError>::Err(std::move(textR.error()));
 
-        auto rawR = parser.Parse(textR.value(), catalogJsonPath);
+        // entry は textR を指す view のまま BuildFromRaw_ へ渡す（ここでは文字列をコピーしない）
+        auto rawR = parser.ParseViews(textR.value(), catalogJsonPath);
         if (!rawR) return Base::Result<void, AssetError>::Err(std::move(rawR.error()));
 
-        return BuildFromRaw_(rawR.value(), resolver);
+        return BuildFromRaw_(rawR.value(), resolver, out);
     }
 
-    Base::Result<void, AssetError>
-    AssetCatalog::BuildFromRaw_(const std::vector<Catalog::RawCatalogEntry>& raw,
-                                const Resolver::AssetPathResolver& resolver) {
-        for (const auto& r : raw) {
-            // ここはあなたの AssetId/AssetType 実装に合わせる
-            // （FromString が無いなら、ここだけ差し替え）
-            const AssetId id = AssetId::FromString(r.id);
-            const AssetType type = AssetType::FromString(r.type);
-
-            // 重複IDはエラー（Catalogの一意性保証）
-            if (map_.find(id) != map_.end()) {
-                return Base::Result<void, AssetError>::Err(
-                    AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "AssetCatalog: duplicated id", r.id));
+    namespace {
+
+        // BuildChunk：並列段で 1 スレッドが受け持つ raw の範囲 [begin, end)
+        struct BuildChunk final {
+            std::size_t begin = 0;
+            std::size_t end = 0;
+
+            // 範囲内で最初に path 解決に失敗した index（無ければ end）。以降は作らない（id / type だけは入れてある）
+            std::size_t failedAt = 0;
+            std::string failMessage;
+        };
+
+        // path 解決と entry 作成（スレッドごとに別の範囲・別の要素にしか書かないのでロック不要）
+        // - id / type はハッシュだけ計算する。NameTable への登録は直列段で catalog の順に行う
+        void PrepareChunk(const std::vector<Catalog::RawCatalogEntryView>& raw,
+                          const Resolver::AssetPathResolver& resolver,
+                          std::vector<Catalog::CatalogEntry>& out,
+                          BuildChunk& chunk) {
+            chunk.failedAt = chunk.end;
+            std::string scratch; // スレッドごとに使い回す解決先（entry には長さぴったりで写す）
+            for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+                const auto& r = raw[i];
+                auto& e = out[i];
+                e.id = AssetId(Detail::Fnv1a64(r.id));
+                e.type = AssetType(Detail::Fnv1a64(r.type));
+
+                // ★ここで resolvedPath を確定させる（root脱出などもここで弾く）
+                scratch.clear();
+                auto rp = resolver.ResolveAppend(r.path, scratch);
+                if (!rp) {
+                    chunk.failedAt = i;
+                    chunk.failMessage = std::move(rp.error().message);
+                    return;
+                }
+
+                e.sourcePath = std::string(r.path);
+                e.resolvedPath = std::string(rp.value());
             }
+        }
+
+    } // namespace
+
+    Base::Result<void, AssetError>
+    AssetCatalog::BuildFromRaw_(const std::vector<Catalog::RawCatalogEntryView>& raw,
+                                const Resolver::AssetPathResolver& resolver,
+                                EntryMap& out) const {
+        // 1) 並列段：raw を連続した範囲に分け、path 解決と entry 作成をスレッドごとに行う
+        std::uint32_t threads = opt_.buildThreads;
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        const std::size_t perThread = std::max<std::size_t>(1, opt_.minEntriesPerBuildThread);
+        threads = static_cast<std::uint32_t>(std::clamp<std::size_t>(raw.size() / perThread, 1, threads));
 
-            // ★ここで resolvedPath を確定させる（root脱出などもここで弾く）
-            auto rp = resolver.Resolve(r.path);
-            if (!rp) {
-                // resolver が InvalidPath / PathEscapesRoot を返す
-                return Base::Result<void, AssetError>::Err(AssetError::Make(
-                    AssetErrorCode::InvalidPath,
-                    rp.error().message,
-                    r.id));
+        std::vector<Catalog::CatalogEntry> prepared(raw.size());
+        std::vector<BuildChunk> chunks(threads);
+        for (std::uint32_t t = 0; t < threads; ++t) {
+            chunks[t].begin = raw.size() * t / threads;
+            chunks[t].end = raw.size() * (t + 1) / threads;
+        }
+
+        {
+            std::vector<std::thread> workers;
+            workers.reserve(threads - 1);
+            for (std::uint32_t t = 1; t < threads; ++t) {
+                workers.emplace_back([&, t] { PrepareChunk(raw, resolver, prepared, chunks[t]); });
             }
+            PrepareChunk(raw, resolver, prepared, chunks[0]); // 呼び出したスレッドも 1 範囲受け持つ
+            for (auto& w : workers) w.join();
+        }
+
+        // 2) 直列段：catalog の順に intern / 重複検査 / 登録する（エラーはスレッド数によらず先頭から最初の 1 件）
+        out.reserve(out.size() + raw.size());
+        for (const auto& chunk : chunks) {
+            for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+                const auto& r = raw[i];
+                auto& e = prepared[i];
 
-            Catalog::CatalogEntry e;
-            e.id = id;
-            e.type = type;
-            e.sourcePath = r.path;
-            e.resolvedPath = std::move(rp.value());
+                // 名前を intern する。別の文字列が同じハッシュになっていたら衝突（以降は値だけで比べるのでここで弾く）
+                if (Detail::AssetIdNames().Intern(e.id.value, r.id) == Detail::NameTable::InternResult::Collision) {
+                    return Base::Result<void, AssetError>::Err(AssetError::Make(
+                        AssetErrorCode::InvalidCatalogEntry, "AssetCatalog: id hash collision",
+                        std::string(r.id) + " vs " + std::string(e.id.DebugName())));
+                }
+                if (Detail::AssetTypeNames().Intern(e.type.value, r.type) == Detail::NameTable::InternResult::Collision) {
+                    return Base::Result<void, AssetError>::Err(AssetError::Make(
+                        AssetErrorCode::InvalidCatalogEntry, "AssetCatalog: type hash collision",
+                        std::string(r.type) + " vs " + std::string(e.type.DebugName())));
+                }
 
-            map_.emplace(e.id, std::move(e));
+                // 重複IDはエラー（Catalogの一意性保証）
+                if (out.find(e.id) != out.end()) {
+                    return Base::Result<void, AssetError>::Err(
+                        AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "AssetCatalog: duplicated id", std::string(r.id)));
+                }
+
+                if (i == chunk.failedAt) {
+                    // resolver が InvalidPath / PathEscapesRoot を返す
+                    return Base::Result<void, AssetError>::Err(AssetError::Make(
+                        AssetErrorCode::InvalidPath,
+                        chunk.failMessage,
+                        std::string(r.id)));
+                }
+
+                const AssetId id = e.id;
+                out.emplace(id, std::move(e));
+            }
         }
 
         return Base::Result<void, AssetError>::Ok();
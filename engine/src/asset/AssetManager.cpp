@@ -1,9 +1,17 @@
 #include "engine/asset/AssetManager.hpp"
 
+#include <chrono>
+
 #include "engine/asset/AssetCatalog.hpp" // AssetCatalog 実装に合わせて include
 
 namespace Engine::Asset {
 
+    static std::uint64_t NowNs() noexcept {
+        using namespace std::chrono;
+        return static_cast<std::uint64_t>(
+            duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+
     AssetManager::AssetManager(AssetCatalog& catalog,
                                Loading::AssetPipeline& pipeline,
                                Core::AssetStorage& storage,
@@ -19,11 +27,34 @@ namespace Engine::Asset {
         , stats_(stats)
         , watcher_(watcher) {}
 
-    void AssetManager::SetOptions(Options opt) { opt_ = opt; }
+    AssetManager::~AssetManager() {
+        // worker が pipeline を触っている間に依存先が消えないよう、先に止める
+        workers_.reset();
+    }
+
+    void AssetManager::SetOptions(Options opt) {
+        const bool rebuild = (opt.workerThreads != opt_.workerThreads);
+        opt_ = opt;
+
+        if (opt_.deferDestruction) {
+            if (graveyard_) graveyard_->SetOptions(opt_.graveyard);
+            else graveyard_ = std::make_unique<Core::AssetGraveyard>(opt_.graveyard);
+        } else {
+            graveyard_.reset(); // 預かっていた分は破棄し終えてから止まる
+        }
+
+        Loading::LoadScheduler::Options so = queue_.GetOptions();
+        so.agingFrames = opt_.priorityAgingFrames;
+        queue_.SetOptions(so);
+
+        if (rebuild) RebuildWorkers_();
+    }
     const AssetManager::Options& AssetManager::GetOptions() const noexcept { return opt_; }
 
     void AssetManager::BeginFrame(std::uint64_t frameIndex) {
         frame_ = frameIndex;
+        // フレーム境界を同期点にして、前フレームまでに消した record を解放する
+        storage_.ReclaimRetired(graveyard_.get());
     }
 
     void AssetManager::Update() {
@@ -31,6 +62,16 @@ namespace Engine::Asset {
             ProcessHotReload_();
         }
         ProcessQueue_();
+        TrimToBudget_();
+    }
+
+    void AssetManager::WaitForAsyncLoads() {
+        if (!workers_) return;
+        while (!queue_.Empty() || !inFlight_.empty()) {
+            DispatchToWorkers_();
+            workers_->WaitIdle();
+            PublishCompleted_();
+        }
     }
 
     // ---------------- public API ----------------
@@ -45,20 +86,35 @@ namespace Engine::Asset {
         const ResolvedEntry e = std::move(entryR.value());
 
         // 2) record 準備
-        Core::AssetRecord& rec = GetOrCreateRecord_(id, e);
+        Core::AssetRecord* recP = GetOrCreateRecord_(id, e);
+        if (!recP) {
+            return Base::Result<AssetHandle, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InternalError, "AssetStorage: record limit reached", e.resolvedPath));
+        }
+        Core::AssetRecord& rec = *recP;
+
+        // 3) pin / TTL（キャッシュヒットでも反映する）
+        if (request.pin) {
+            lifetime_.Pin(id);
+        }
+        if (request.keepAliveFramesOverride != 0) {
+            // この asset の TTL を上書き（evict されるまで残る。次の要求で上書きし直せる）
+            lifetime_.SetKeepAliveOverride(id, request.keepAliveFramesOverride);
+        }
 
-        // 3) 既に Ready で reload しないなら、キャッシュヒット
+        // 4) 既に Ready で reload しないなら、キャッシュヒット
         const bool wantReload = request.IsReload();
         if (rec.IsReady() && !wantReload) {
             if (stats_) stats_->OnCacheHit(id);
             lifetime_.Touch(id, frame_);
+            NoteAccess_(rec);
 
             // Acquire 相当
-            ++rec.refCount;
+            AddRef_(rec);
 
             // typed handle を使いたい場合は、Load<T>() を別途用意して MakeTyped<T>() を返すのが自然
             return Base::Result<AssetHandle, AssetError>::Ok(
-                AssetHandle::Make(id, rec.generation)
+                AssetHandle::Make(id, rec.generation, rec.slot)
             );
         }
 
@@ -66,16 +122,6 @@ namespace Engine::Asset {
             if (stats_) stats_->OnCacheMiss();
         }
 
-        // 4) pin / TTL（必要ならここで適用）
-        if (request.pin) {
-            lifetime_.Pin(id);
-        }
-        if (request.keepAliveFramesOverride != 0) {
-            // keepAliveFramesOverride は policy 側に “この要求だけ” 反映したいが、
-            // ここでは “情報として保持” する場所がないため、運用で policy を切り替えるか、
-            // lifetime 側に別mapを持たせて拡張するのがよい。
-        }
-
         // 5) Async ならキューへ
         if (request.IsAsync()) {
             // すでに Loading 中なら二重投入しない
@@ -83,13 +129,16 @@ namespace Engine::Asset {
                 rec.MarkLoading();
                 EnqueueLoad_(id, request);
                 if (stats_) stats_->OnLoadStart();
+            } else if (queue_.Contains(id)) {
+                // まだキュー待ちなら、後から来た要求の priority を反映する
+                EnqueueLoad_(id, request);
             }
 
             // Acquire 相当：呼んだ側はこのhandleを保持する前提
-            ++rec.refCount;
+            AddRef_(rec);
 
             return Base::Result<AssetHandle, AssetError>::Ok(
-                AssetHandle::Make(id, rec.generation)
+                AssetHandle::Make(id, rec.generation, rec.slot)
             );
         }
 
@@ -101,9 +150,11 @@ namespace Engine::Asset {
             if (request.fallback == AssetRequest::Fallback::KeepOldIfAny && rec.IsReady()) {
                 // 失敗理由は rec.error に残す（※ Ready でも error を持つのは「例外運用」）
                 return Base::Result<AssetHandle, AssetError>::Ok(
-                    AssetHandle::Make(id, rec.generation)
+                    AssetHandle::Make(id, rec.generation, rec.slot)
                 );
             }
+            // 誰も持たない Failed record も trim の対象にできるよう LRU へ入れる
+            if (rec.refCount == 0) lifetime_.OnUnreferenced(id, frame_);
             return Base::Result<AssetHandle, AssetError>::Err(std::move(loadR.error()));
         }
 
@@ -111,10 +162,10 @@ namespace Engine::Asset {
         lifetime_.OnLoaded(id, frame_);
 
         // Acquire 相当
-        ++rec.refCount;
+        AddRef_(rec);
 
         return Base::Result<AssetHandle, AssetError>::Ok(
-            AssetHandle::Make(id, rec.generation)
+            AssetHandle::Make(id, rec.generation, rec.slot)
         );
     }
 
@@ -122,8 +173,9 @@ namespace Engine::Asset {
         Core::AssetRecord* rec = FindRecord_(h);
         if (!rec) return false;
         if (rec->generation != h.generation()) return false;
-        ++rec->refCount;
+        AddRef_(*rec);
         lifetime_.Touch(h.id(), frame_);
+        NoteAccess_(*rec);
         return true;
     }
 
@@ -132,8 +184,11 @@ namespace Engine::Asset {
         if (!rec) return;
         if (rec->generation != h.generation()) return;
 
-        if (rec->refCount > 0) --rec->refCount;
-        // 解放後の eviction は「上位が EvictIfPossible を呼ぶ」運用にしておく（自動evictは後で）
+        if (rec->refCount == 0) return;
+        if (--rec->refCount == 0) {
+            // 参照が切れたら LRU へ。Budgeted なら Update() の trim がここから古い順に消す
+            lifetime_.OnUnreferenced(rec->id, frame_);
+        }
     }
 
     AssetState AssetManager::GetState(const AssetHandle& h) const {
@@ -157,15 +212,173 @@ namespace Engine::Asset {
 
         if (!cachePolicy_.IsEvictable(*rec, lifetime_, frame_)) return false;
 
-        // record を消す前に lifetime/statistics を更新
+        // record を消す前に lifetime/statistics/常駐バイトを更新
         lifetime_.OnEvicted(id);
         if (stats_) stats_->OnEvict(id);
+        ForgetResidentBytes_(*rec);
+        NoteRemoved_(id);
 
         // 強制で erase
         storage_.EraseIf(id, true);
         return true;
     }
 
+    std::size_t AssetManager::TrimToBudget_() {
+        const auto& popt = cachePolicy_.GetOptions();
+        if (popt.mode != Core::AssetCachePolicy::Mode::Budgeted) return 0;
+
+        // 上限からはみ出している量（数 / 合計バイト / type 別バイト）
+        const std::size_t count = storage_.Size();
+        std::size_t excessCount = (popt.maxAssets != 0 && count > popt.maxAssets) ? count - popt.maxAssets : 0;
+        std::uint64_t excessBytes =
+            (popt.maxBytesRead != 0 && residentBytes_ > popt.maxBytesRead) ? residentBytes_ - popt.maxBytesRead : 0;
+
+        trimTypeExcess_.clear();
+        std::size_t typesOver = 0;
+        for (const auto& [type, bytes] : residentBytesByType_) {
+            if (!cachePolicy_.ShouldTrimType(type, bytes)) continue;
+            trimTypeExcess_[type] = bytes - cachePolicy_.GetTypeByteBudget(type);
+            ++typesOver;
+        }
+        if (excessCount == 0 && excessBytes == 0 && typesOver == 0) return 0;
+
+        // 消す順に見て、はみ出しを減らせるものを拾う（走査中は消さない）
+        // - pinned / Loading / 残す設定の Failed / 参照中は飛ばして次を見る
+        // - type 別だけがはみ出しているときは、その type の asset だけを消す
+        trimVictims_.clear();
+        auto consider = [&](const AssetId& id) {
+            const Core::AssetRecord* rec = storage_.Find(id);
+            if (!rec || !cachePolicy_.IsEvictable(*rec, lifetime_, frame_)) return true;
+
+            auto typeIt = trimTypeExcess_.find(rec->type);
+            const bool typeOver = typeIt != trimTypeExcess_.end() && typeIt->second > 0;
+            const std::uint64_t bytes = rec->residentBytes;
+            if (excessCount == 0 && (bytes == 0 || (excessBytes == 0 && !typeOver))) return true;
+
+            trimVictims_.push_back(id);
+            if (excessCount > 0) --excessCount;
+            excessBytes = (excessBytes > bytes) ? excessBytes - bytes : 0;
+            if (typeOver) {
+                typeIt->second = (typeIt->second > bytes) ? typeIt->second - bytes : 0;
+                if (typeIt->second == 0) --typesOver;
+            }
+            return excessCount > 0 || excessBytes > 0 || typesOver > 0;
+        };
+
+        SyncEvictor_();
+        bool more = true;
+        if (evictor_) {
+            evictor_->ForEachVictim([&](const AssetId& id) { return more = consider(id); });
+        }
+        if (more) {
+            // Lru：参照の無い asset の LRU を古い側から
+            // （Lru 以外でも、切り替え前から常駐していて strategy がまだ知らない asset はここで拾う）
+            // LRU は lastAccessFrame 順なので、TTL が全 asset で同じなら、切れていない entry に当たったら以降も切れていない
+            // （type 別 / asset ごとの TTL があるときは飛ばして続ける）
+            const bool uniformTtl = popt.keepAliveFramesPerType.empty() && lifetime_.KeepAliveOverrideCount() == 0;
+            lifetime_.ForEachUnreferenced([&](const AssetId& id, const Core::AssetLifetime::Info&) {
+                if (uniformTtl && !lifetime_.IsExpired(id, frame_, popt.keepAliveFrames)) return false;
+                if (evictor_ && evictor_->Contains(id)) return true;
+                return consider(id);
+            });
+        }
+
+        for (const AssetId& id : trimVictims_) {
+            lifetime_.OnEvicted(id);
+            if (stats_) stats_->OnEvict(id);
+            if (const Core::AssetRecord* rec = storage_.Find(id)) ForgetResidentBytes_(*rec);
+            NoteRemoved_(id);
+            storage_.EraseIf(id, true);
+        }
+        return trimVictims_.size();
+    }
+
+    void AssetManager::SetResidentBytes_(Core::AssetRecord& rec, std::uint64_t bytes) {
+        if (rec.residentBytes == bytes) return;
+
+        residentBytes_ -= rec.residentBytes;
+        residentBytes_ += bytes;
+
+        auto& byType = residentBytesByType_[rec.type];
+        byType -= rec.residentBytes;
+        byType += bytes;
+        if (byType == 0) residentBytesByType_.erase(rec.type);
+
+        rec.residentBytes = bytes;
+    }
+
+    void AssetManager::ForgetResidentBytes_(const Core::AssetRecord& rec) {
+        if (rec.residentBytes == 0) return;
+        residentBytes_ -= rec.residentBytes;
+        auto it = residentBytesByType_.find(rec.type);
+        if (it != residentBytesByType_.end() && (it->second -= rec.residentBytes) == 0) residentBytesByType_.erase(it);
+    }
+
+    void AssetManager::SyncEvictor_() {
+        const Core::EvictionAlgorithm algo = cachePolicy_.GetOptions().eviction;
+        if (algo == Core::EvictionAlgorithm::Lru) {
+            evictor_.reset();
+            return;
+        }
+        if (!evictor_ || evictor_->Algorithm() != algo) {
+            evictor_ = Core::MakeEvictionStrategy(algo, cachePolicy_.GetOptions().maxAssets);
+        }
+    }
+
+    void AssetManager::NoteAccess_(const Core::AssetRecord& rec) {
+        if (trace_) trace_->push_back(Core::EvictionTraceEvent{ rec.id, rec.residentBytes, rec.sourceBytes });
+
+        SyncEvictor_();
+        if (!evictor_) return;
+        // 切り替え前から常駐していた asset は、ここで初めて入る
+        if (evictor_->Contains(rec.id)) evictor_->OnAccess(rec.id);
+        else evictor_->OnInsert(rec.id, rec.residentBytes, rec.sourceBytes);
+    }
+
+    void AssetManager::NoteLoaded_(const Core::AssetRecord& rec) {
+        if (trace_) trace_->push_back(Core::EvictionTraceEvent{ rec.id, rec.residentBytes, rec.sourceBytes });
+
+        SyncEvictor_();
+        if (evictor_) evictor_->OnInsert(rec.id, rec.residentBytes, rec.sourceBytes);
+    }
+
+    void AssetManager::NoteRemoved_(const AssetId& id) {
+        if (evictor_) evictor_->OnRemove(id);
+    }
+
+    void AssetManager::AddRef_(Core::AssetRecord& rec) {
+        if (rec.refCount++ == 0) lifetime_.OnReferenced(rec.id);
+    }
+
+    std::size_t AssetManager::ApplyCatalogDiff(const Catalog::CatalogDiff& diff) {
+        if (watcher_) {
+            for (const auto& id : diff.removed) watcher_->Unwatch(id);
+        }
+
+        std::size_t reloads = 0;
+        for (const auto& id : diff.changed) {
+            Core::AssetRecord* rec = storage_.Find(id);
+            if (!rec) continue; // まだ誰も読んでいない：次の Load で新しい entry が使われる
+
+            Catalog::CatalogEntryView entry;
+            if (!catalog_.FindView(id, entry)) continue;
+
+            // type が変わったら常駐バイトの集計先も移す
+            const std::uint64_t resident = rec->residentBytes;
+            SetResidentBytes_(*rec, 0);
+            rec->type = entry.type;
+            SetResidentBytes_(*rec, resident);
+            rec->resolvedPath = std::string(entry.resolvedPath);
+            if (watcher_ && watcher_->IsWatching(id)) watcher_->Watch(id, rec->resolvedPath);
+
+            // Unloaded（中身を捨てた record）は次の Load まで読まない
+            if (rec->state == AssetState::Unloaded) continue;
+            EnqueueReload_(id);
+            ++reloads;
+        }
+        return reloads;
+    }
+
     void AssetManager::Watch(const AssetId& id, std::string resolvedPath) {
         if (!watcher_) return;
         watcher_->Watch(id, std::move(resolvedPath));
@@ -182,10 +395,18 @@ namespace Engine::Asset {
     AssetManager::ResolveEntry_(const AssetId& id, const AssetRequest& req) {
         if (stats_) stats_->OnCatalogLookup();
 
-        // CatalogEntry { AssetType type; std::string resolvedPath; } が引ける
-        const auto* entry = catalog_.Find(id); //
-        if (!entry) {
+        // (type, resolvedPath) を確保無しで引く（バイナリ catalog なら mmap 領域を直接見る）
+        Catalog::CatalogEntryView entry;
+        if (!catalog_.FindView(id, entry)) {
             if (stats_) stats_->OnCatalogMiss();
+
+            // Catalog に無くても overridePath + type hint があれば直接ロードできる（テスト/ツール用）
+            if (req.HasOverridePath() && req.useTypeHint && req.expectedType != AssetType::Invalid()) {
+                ResolvedEntry out;
+                out.type = req.expectedType;
+                out.resolvedPath = req.overridePath;
+                return Base::Result<ResolvedEntry, AssetError>::Ok(std::move(out));
+            }
             return Base::Result<ResolvedEntry, AssetError>::Err(
                 AssetError::Make(AssetErrorCode::CatalogNotFound, "AssetCatalog: id not found")
             );
@@ -193,7 +414,7 @@ namespace Engine::Asset {
 
         // type hint check
         if (req.useTypeHint && req.expectedType.value != 0) {
-            if (req.expectedType.value != entry->type.value) {
+            if (req.expectedType.value != entry.type.value) {
                 return Base::Result<ResolvedEntry, AssetError>::Err(
                     AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "AssetRequest: expectedType mismatch")
                 );
@@ -201,11 +422,11 @@ namespace Engine::Asset {
         }
 
         ResolvedEntry out;
-        out.type = entry->type;
+        out.type = entry.type;
 
         // override path がある場合：ここでは “resolvedPath として扱う”
         // 必要ならここで AssetPathResolver を通して正規化してOK（設計上はCatalog側が担当）
-        out.resolvedPath = req.overridePath.empty() ? entry->resolvedPath : req.overridePath;
+        out.resolvedPath = req.overridePath.empty() ? std::string(entry.resolvedPath) : req.overridePath;
 
         if (out.resolvedPath.empty()) {
             return Base::Result<ResolvedEntry, AssetError>::Err(
@@ -216,27 +437,46 @@ namespace Engine::Asset {
         return Base::Result<ResolvedEntry, AssetError>::Ok(std::move(out));
     }
 
-    Core::AssetRecord& AssetManager::GetOrCreateRecord_(const AssetId& id, const ResolvedEntry& e) {
+    Core::AssetRecord* AssetManager::GetOrCreateRecord_(const AssetId& id, const ResolvedEntry& e) {
         // 初回だけ type/path がセットされる（既存なら保持）
         return storage_.GetOrCreate(id, e.type, e.resolvedPath);
     }
 
-    Base::Result<void, AssetError>
-    AssetManager::DoLoadSync_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req) {
-        const bool wasReady = rec.IsReady();
-
-        // ForceReload のときは “読み込み前に Loading へ”
-        rec.MarkLoading();
-
+    Loading::LoadContext
+    AssetManager::MakeContext_(const Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest* req) const {
         Loading::LoadContext ctx;
         ctx.id = rec.id;
         ctx.type = e.type;
         ctx.resolvedPath = e.resolvedPath;
-        ctx.request = &req;
+        ctx.request = req;
         ctx.statistics = stats_;
         ctx.nowFrame = frame_;
+        return ctx;
+    }
 
-        auto r = pipeline_.Load(ctx);
+    Base::Result<void, AssetError>
+    AssetManager::DoLoadSync_(Core::AssetRecord& rec, const ResolvedEntry& e, const AssetRequest& req,
+                              Loading::LoadReport* report) {
+        const bool wasReady = rec.IsReady();
+
+        // ForceReload のときは “読み込み前に Loading へ”
+        rec.MarkLoading();
+
+        Loading::LoadReport local{};
+        if (!report) report = &local;
+
+        const Loading::LoadContext ctx = MakeContext_(rec, e, &req);
+        auto r = pipeline_.Load(ctx, report);
+        return CommitLoadResult_(rec, e.resolvedPath, req, wasReady, std::move(r), *report);
+    }
+
+    Base::Result<void, AssetError>
+    AssetManager::CommitLoadResult_(Core::AssetRecord& rec,
+                                    const std::string& resolvedPath,
+                                    const AssetRequest& req,
+                                    bool wasReady,
+                                    Base::Result<Core::AnyAsset, AssetError> r,
+                                    const Loading::LoadReport& report) {
         if (!r) {
             // Reload + KeepOldIfAny + 旧データあり => 旧キャッシュ維持
             if (req.fallback == AssetRequest::Fallback::KeepOldIfAny && wasReady) {
@@ -249,6 +489,8 @@ namespace Engine::Asset {
             }
 
             rec.SetFailed(std::move(r.error()));
+            SetResidentBytes_(rec, 0);
+            NoteRemoved_(rec.id);
             return Base::Result<void, AssetError>::Err(rec.error);
         }
 
@@ -260,28 +502,47 @@ namespace Engine::Asset {
         }
 
         rec.SetReady(std::move(r.value()));
+        rec.sourceBytes = report.bytesRead;
+        SetResidentBytes_(rec, report.decodedBytes);
+        NoteLoaded_(rec);
         // resolvedPath を record に持たせておく（便利）
-        if (rec.resolvedPath.empty()) rec.resolvedPath = e.resolvedPath;
+        if (rec.resolvedPath.empty()) rec.resolvedPath = resolvedPath;
 
         return Base::Result<void, AssetError>::Ok();
     }
 
     void AssetManager::EnqueueLoad_(const AssetId& id, const AssetRequest& req) {
-        // 重複投入を防ぐ（同じIDがキューにいるならスキップ）
-        if (queued_.find(id) != queued_.end()) return;
-
-        queue_.push_back(PendingLoad{ id, req });
-        queued_.insert(id);
+        // 同じIDがキューにいる場合はマージ（priority 引き上げ / Reload 上書き）
+        queue_.Push(id, req, frame_);
     }
 
     void AssetManager::ProcessQueue_() {
-        if (queue_.empty()) return;
+        const std::uint64_t budgetNs = opt_.frameBudgetUs * 1000ull;
+
+        if (workers_) {
+            // 先に publish して in-flight 枠を空けてから次を投げる
+            PublishCompleted_(budgetNs);
+            DispatchToWorkers_();
+            return;
+        }
+
+        if (queue_.Empty()) return;
+
+        const std::uint64_t startNs = NowNs();
+        std::uint32_t processed = 0;
 
         std::uint32_t budget = opt_.maxLoadsPerFrame;
-        while (budget > 0 && !queue_.empty()) {
-            PendingLoad job = std::move(queue_.front());
-            queue_.pop_front();
-            queued_.erase(job.id);
+        Loading::LoadScheduler::Entry job;
+        while ((budgetNs != 0 || budget > 0) && queue_.Pop(job)) {
+            // 時間予算モード：次の1件が予算に収まらないなら次フレームへ
+            if (budgetNs != 0 && processed > 0) {
+                const std::uint64_t elapsed = NowNs() - startNs;
+                if (elapsed + EstimateLoadNs_(job.id) > budgetNs) {
+                    queue_.Restore(std::move(job));
+                    break;
+                }
+            }
+            ++processed;
 
             // catalog resolve
             auto entryR = ResolveEntry_(job.id, job.req);
@@ -289,24 +550,150 @@ namespace Engine::Asset {
                 // catalog 失敗：record があれば Failed に落とす
                 if (auto* rec = storage_.Find(job.id)) {
                     rec->SetFailed(std::move(entryR.error()));
+                    SetResidentBytes_(*rec, 0);
                 }
-                --budget;
+                if (budget > 0) --budget;
                 continue;
             }
 
             const ResolvedEntry e = std::move(entryR.value());
-            Core::AssetRecord& rec = GetOrCreateRecord_(job.id, e);
+            Core::AssetRecord* recP = GetOrCreateRecord_(job.id, e);
+            if (!recP) {
+                // record を作れない（AssetStorage の上限）：ReclaimRetired で空くまで捨てる
+                if (budget > 0) --budget;
+                continue;
+            }
+            Core::AssetRecord& rec = *recP;
 
-            // 実ロード（sync実行）
-            (void)DoLoadSync_(rec, e, job.req);
+            // 実ロード（sync実行）：実測でコストモデルを学習する
+            Loading::LoadReport report{};
+            const std::uint64_t t0 = NowNs();
+            (void)DoLoadSync_(rec, e, job.req, &report);
+            costModel_.Observe(report.bytesRead, NowNs() - t0);
 
             // 成功なら寿命更新
             if (rec.IsReady()) lifetime_.OnLoaded(rec.id, frame_);
 
-            --budget;
+            if (budget > 0) --budget;
+        }
+    }
+
+    std::uint64_t AssetManager::EstimateLoadNs_(const AssetId& id) const {
+        std::uint64_t bytes = 0; // 0 = 不明（モデルの平均サイズを使う）
+        if (stats_) {
+            if (const auto* pa = stats_->Find(id)) bytes = pa->lastBytesRead;
+        }
+        return costModel_.EstimateNs(bytes);
+    }
+
+    void AssetManager::RebuildWorkers_() {
+        // 既存 worker の結果は捨てずに publish してから作り直す
+        if (workers_) {
+            workers_->WaitIdle();
+            PublishCompleted_();
+            workers_.reset();
+        }
+        if (opt_.workerThreads > 0) {
+            workers_ = std::make_unique<Loading::AssetWorkerPool>(pipeline_, opt_.workerThreads);
+        }
+    }
+
+    void AssetManager::DispatchToWorkers_() {
+        if (!workers_) return;
+
+        // 同じ id が実行中なら今回は見送る（順位を保ったままキューへ戻す）
+        std::vector<Loading::LoadScheduler::Entry> deferred;
+        std::vector<Loading::AssetWorkerPool::Job> ready;
+
+        Loading::LoadScheduler::Entry job;
+        while (inFlight_.size() < opt_.maxInFlightLoads && queue_.Pop(job)) {
+            if (inFlight_.find(job.id) != inFlight_.end()) {
+                deferred.push_back(std::move(job));
+                continue;
+            }
+
+            auto entryR = ResolveEntry_(job.id, job.req);
+            if (!entryR) {
+                if (auto* rec = storage_.Find(job.id)) {
+                    rec->SetFailed(std::move(entryR.error()));
+                    SetResidentBytes_(*rec, 0);
+                }
+                continue;
+            }
+
+            const ResolvedEntry e = std::move(entryR.value());
+            Core::AssetRecord* recP = GetOrCreateRecord_(job.id, e);
+            if (!recP) continue; // record を作れない（AssetStorage の上限）
+            Core::AssetRecord& rec = *recP;
+
+            const bool wasReady = rec.IsReady();
+            rec.MarkLoading();
+
+            Loading::AssetWorkerPool::Job w;
+            w.ctx = MakeContext_(rec, e, nullptr);
+            w.request = std::move(job.req);
+            inFlight_.emplace(job.id, wasReady);
+            ready.push_back(std::move(w));
+        }
+
+        for (auto& d : deferred) {
+            queue_.Restore(std::move(d));
+        }
+
+        // 優先度順のまま、worker 数で均等割りしたバッチにして投げる
+        if (ready.empty()) return;
+        const std::size_t threads = workers_->ThreadCount();
+        std::size_t batchSize = (ready.size() + threads - 1) / threads;
+        if (opt_.ioBatchSize > 0 && batchSize > opt_.ioBatchSize) batchSize = opt_.ioBatchSize;
+        if (batchSize == 0) batchSize = 1;
+
+        for (std::size_t i = 0; i < ready.size(); i += batchSize) {
+            const std::size_t end = (i + batchSize < ready.size()) ? i + batchSize : ready.size();
+            std::vector<Loading::AssetWorkerPool::Job> batch;
+            batch.reserve(end - i);
+            for (std::size_t k = i; k < end; ++k) batch.push_back(std::move(ready[k]));
+            workers_->SubmitBatch(std::move(batch));
         }
     }
 
+    void AssetManager::PublishCompleted_(std::uint64_t budgetNs) {
+        if (!workers_) return;
+
+        workers_->DrainCompleted(completed_);
+        if (completed_.empty()) return;
+
+        const std::uint64_t startNs = NowNs();
+        std::size_t published = 0;
+
+        for (; published < completed_.size(); ++published) {
+            // 時間予算：最低1件は publish し、超えたら残りは次フレームへ
+            if (budgetNs != 0 && published > 0 && (NowNs() - startNs) > budgetNs) break;
+
+            auto& c = completed_[published];
+            bool wasReady = false;
+            if (auto it = inFlight_.find(c.id); it != inFlight_.end()) {
+                wasReady = it->second;
+                inFlight_.erase(it);
+            }
+
+            if (stats_) {
+                if (c.result) {
+                    stats_->OnLoadSuccess(c.id, c.type, frame_, c.report.bytesRead, c.report.decodedBytes);
+                } else {
+                    stats_->OnLoadFailure(c.id, c.type, frame_);
+                }
+            }
+
+            // 実行中に evict された record には publish しない
+            Core::AssetRecord* rec = storage_.Find(c.id);
+            if (!rec) continue;
+
+            (void)CommitLoadResult_(*rec, c.resolvedPath, c.request, wasReady, std::move(c.result), c.report);
+            if (rec->IsReady()) lifetime_.OnLoaded(rec->id, frame_);
+        }
+        completed_.erase(completed_.begin(), completed_.begin() + static_cast<std::ptrdiff_t>(published));
+    }
+
     void AssetManager::ProcessHotReload_() {
         if (!watcher_) return;
 
@@ -314,24 +701,27 @@ namespace Engine::Asset {
         if (changes.empty()) return;
 
         for (auto& c : changes) {
-            AssetRequest r = AssetRequest::Reload();
-            r.sync = AssetRequest::SyncWith::Async;
-            r.fallback = opt_.reloadKeepOldIfAny ? AssetRequest::Fallback::KeepOldIfAny
-                                                : AssetRequest::Fallback::None;
-            EnqueueLoad_(c.id, r);
+            EnqueueReload_(c.id);
         }
     }
 
+    void AssetManager::EnqueueReload_(const AssetId& id) {
+        AssetRequest r = AssetRequest::Reload();
+        r.sync = AssetRequest::SyncWith::Async;
+        r.fallback = opt_.reloadKeepOldIfAny ? AssetRequest::Fallback::KeepOldIfAny
+                                            : AssetRequest::Fallback::None;
+        EnqueueLoad_(id, r);
+    }
+
     Core::AssetRecord* AssetManager::FindRecord_(const AssetHandle& h) {
-        Core::AssetRecord* rec = storage_.Find(h.id());
-        if (!rec) return nullptr;
-        return rec;
+        // slot 付きなら添字 + 世代比較だけ（stale は nullptr）
+        if (h.has_slot()) return storage_.Resolve(h.slot(), h.generation());
+        return storage_.Find(h.id());
     }
 
     const Core::AssetRecord* AssetManager::FindRecordConst_(const AssetHandle& h) const {
-        const Core::AssetRecord* rec = storage_.Find(h.id());
-        if (!rec) return nullptr;
-        return rec;
+        if (h.has_slot()) return storage_.Resolve(h.slot(), h.generation());
+        return storage_.Find(h.id());
     }
 
 } // namespace Engine::Asset
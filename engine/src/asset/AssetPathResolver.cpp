@@ -1,12 +1,142 @@
 #include "engine/asset/resolver/AssetPathResolver.hpp"
 
 #include <cctype>
-#include <vector>
 
 namespace Engine::Asset::Resolver {
 
     static inline bool IsSlash(char c) noexcept { return c == '/' || c == '\\'; }
 
+    namespace {
+
+        // NormalizedReader：最大 3 つの部分文字列をつないだものを、NormalizePath した結果として 1 文字ずつ返す
+        // - 途中の文字列は作らない（区切りの '/' 化・連続スラッシュの圧縮はここで行う）
+        // - コピーすると先読みに使える（3 文字程度の覗き見用）
+        class NormalizedReader final {
+        public:
+            NormalizedReader(bool normalizeSeparators, bool squashSlashes) noexcept
+                : normalize_(normalizeSeparators), squash_(squashSlashes) {}
+
+            // alwaysToSlash：normalizeSeparators に関係なく '\\' を '/' にする（assetsRoot 用）
+            void Add(std::string_view part, bool alwaysToSlash = false) noexcept {
+                parts_[count_] = part;
+                toSlash_[count_] = alwaysToSlash || normalize_;
+                ++count_;
+            }
+
+            bool Next(char& out) noexcept {
+                while (index_ < count_) {
+                    const std::string_view part = parts_[index_];
+                    if (pos_ == part.size()) {
+                        ++index_;
+                        pos_ = 0;
+                        continue;
+                    }
+
+                    char c = part[pos_++];
+                    if (toSlash_[index_] && c == '\\') c = '/';
+
+                    if (squash_) {
+                        if (c == '/') {
+                            if (prevSlash_) continue;
+                            prevSlash_ = true;
+                        } else {
+                            prevSlash_ = false;
+                        }
+                    }
+                    out = c;
+                    return true;
+                }
+                return false;
+            }
+
+            // 先頭 3 文字を覗く（読み位置は進めない）。足りない分は '\0'
+            void Peek(char (&buf)[3]) const noexcept {
+                NormalizedReader copy = *this;
+                for (char& c : buf) {
+                    if (!copy.Next(c)) c = '\0';
+                }
+            }
+
+            void Skip(std::size_t n) noexcept {
+                char c;
+                while (n-- > 0 && Next(c)) {}
+            }
+
+        private:
+            std::string_view parts_[3]{};
+            bool toSlash_[3]{};
+            int count_ = 0;
+            int index_ = 0;
+            std::size_t pos_ = 0;
+            bool normalize_ = true;
+            bool squash_ = true;
+            bool prevSlash_ = false;
+        };
+
+        // 正規化済みパスの先頭 3 文字で絶対パスか判定する
+        bool IsAbsolutePrefix(const char (&h)[3]) noexcept {
+            // Unix: "/..."
+            if (h[0] == '/') return true;
+
+            // Windows UNC: "\\server\share"（normalizeSeparators = false なら '\\' のまま来る）
+            if (IsSlash(h[0]) && IsSlash(h[1])) return true;
+
+            // Windows drive: "C:\..." or "C:/..."
+            return std::isalpha(static_cast<unsigned char>(h[0])) && h[1] == ':' && IsSlash(h[2]);
+        }
+
+        // "." / ".." を解決しながら out の末尾へ書く
+        // - 区切りは '/'（reader が正規化済み）。segment の stack は out 自身（".." は直前の '/' まで戻す）
+        // - drive "C:/" / UNC "//" / unix "/" の prefix は保持する
+        void RemoveDotSegmentsInto(NormalizedReader reader, std::string& out, bool& escapedAboveRoot) {
+            escapedAboveRoot = false;
+            const std::size_t base = out.size();
+
+            char h[3];
+            reader.Peek(h);
+            if (std::isalpha(static_cast<unsigned char>(h[0])) && h[1] == ':' && h[2] == '/') {
+                out.append(h, 3);
+                reader.Skip(3);
+            } else if (h[0] == '/' && h[1] == '/') {
+                out.append("//");
+                reader.Skip(2);
+            } else if (h[0] == '/') {
+                out.push_back('/');
+                reader.Skip(1);
+            }
+            const std::size_t segBase = out.size();
+
+            bool more = true;
+            while (more) {
+                // 次の segment を仮に書いてから中身を見る
+                const std::size_t mark = out.size();
+                if (out.size() > base && out.back() != '/') out.push_back('/');
+                const std::size_t segStart = out.size();
+
+                char c;
+                while ((more = reader.Next(c)) && c != '/') out.push_back(c);
+
+                const std::string_view seg(out.data() + segStart, out.size() - segStart);
+                if (seg.empty() || seg == ".") {
+                    out.resize(mark);
+                    continue;
+                }
+                if (seg == "..") {
+                    out.resize(mark);
+                    if (out.size() > segBase) {
+                        // 直前の segment を外す（先頭の segment なら prefix まで戻す）
+                        const std::size_t slash = out.rfind('/');
+                        out.resize((slash == std::string::npos || slash < segBase) ? segBase : slash);
+                    } else {
+                        // ルートより上に出ようとした
+                        escapedAboveRoot = true;
+                    }
+                }
+            }
+        }
+
+    } // namespace
+
     AssetPathResolver::AssetPathResolver(Options opt) : opt_(std::move(opt)) {}
 
     void AssetPathResolver::SetOptions(Options opt) { opt_ = std::move(opt); }
@@ -14,8 +144,20 @@ namespace Engine::Asset::Resolver {
     const AssetPathResolver::Options& AssetPathResolver::GetOptions() const noexcept { return opt_; }
 
     Base::Result<std::string, AssetError> AssetPathResolver::Resolve(std::string_view catalogPath) const {
+        std::string out;
+        out.reserve(opt_.assetsRoot.size() + catalogPath.size() + 8);
+
+        auto r = ResolveAppend(catalogPath, out);
+        if (!r) return Base::Result<std::string, AssetError>::Err(std::move(r.error()));
+        return Base::Result<std::string, AssetError>::Ok(std::move(out));
+    }
+
+    Base::Result<std::string_view, AssetError>
+    AssetPathResolver::ResolveAppend(std::string_view catalogPath, std::string& out) const {
+        using R = Base::Result<std::string_view, AssetError>;
+
         if (catalogPath.empty()) {
-            return Base::Result<std::string, AssetError>::Err(
+            return R::Err(
                 AssetError::Make(
                     AssetErrorCode::InvalidPath,
                     "AssetPathResolver: empty path",
@@ -23,18 +165,29 @@ namespace Engine::Asset::Resolver {
             );
         }
 
-        // 1) スキーム除去（res://, assets://）
-        bool stripped = false;
-        std::string p = opt_.allowSchemes ? StripScheme(catalogPath, stripped)
-                                          : std::string(catalogPath);
+        // 1) スキーム除去（res://, assets://）：scheme 名は検証しない（許可するなら剥がす方針）
+        std::string_view p = catalogPath;
+        if (opt_.allowSchemes) {
+            const auto pos = p.find("://");
+            if (pos != std::string_view::npos) {
+                p.remove_prefix(pos + 3);
+                // "res:///a" のようなケースを "a" に寄せる（先頭スラッシュ削除）
+                while (!p.empty() && IsSlash(p.front())) p.remove_prefix(1);
+            }
+        }
 
-        // 2) 正規化（区切り/連続スラッシュ）
-        p = NormalizePath(p, opt_.normalizeSeparators, opt_.squashSlashes);
+        // 2) 正規化（区切り/連続スラッシュ）は reader が読みながら行う
+        NormalizedReader rel(opt_.normalizeSeparators, opt_.squashSlashes);
+        rel.Add(p);
+
+        const std::size_t base = out.size();
 
         // 3) 絶対パス判定
-        if (IsAbsolutePath(p)) {
+        char head[3];
+        rel.Peek(head);
+        if (IsAbsolutePrefix(head)) {
             if (!opt_.allowAbsolutePath) {
-                return Base::Result<std::string, AssetError>::Err(
+                return R::Err(
                     AssetError::Make(
                         AssetErrorCode::InvalidPath,
                         "AssetPathResolver: absolute path is not allowed",
@@ -44,20 +197,26 @@ namespace Engine::Asset::Resolver {
 
             // 絶対パス許可の場合：dot segments だけ解決（root制約なし）
             bool escaped = false;
-            std::string cleaned = RemoveDotSegments(p, escaped);
-            return Base::Result<std::string, AssetError>::Ok(std::move(cleaned));;
+            RemoveDotSegmentsInto(rel, out, escaped);
+            return R::Ok(std::string_view(out).substr(base));
         }
 
-        // 4) assetsRoot と結合
-        std::string joined = JoinRootAndRelative(opt_.assetsRoot, p);
-        joined = NormalizePath(joined, opt_.normalizeSeparators, opt_.squashSlashes);
+        // 4) assetsRoot と結合："<root>/" + 先頭の区切りを除いた rel（root の '\\' は常に '/' へ寄せる）
+        const std::string_view root = opt_.assetsRoot.empty() ? std::string_view("assets") : std::string_view(opt_.assetsRoot);
+        while (!p.empty() && IsSlash(p.front())) p.remove_prefix(1);
+
+        NormalizedReader joined(opt_.normalizeSeparators, opt_.squashSlashes);
+        joined.Add(root, true);
+        if (!IsSlash(root.back())) joined.Add("/", true);
+        joined.Add(p);
 
         // 5) dot segments 解決（assetsRoot の外へ出るか検出）
         bool escapedAboveRoot = false;
-        std::string cleaned = RemoveDotSegments(joined, escapedAboveRoot);
+        RemoveDotSegmentsInto(joined, out, escapedAboveRoot);
 
         if (escapedAboveRoot && !opt_.allowEscapeAssetsRoot) {
-            return Base::Result<std::string, AssetError>::Err(
+            out.resize(base);
+            return R::Err(
                 AssetError::Make(
                     AssetErrorCode::InvalidPath,
                     "AssetPathResolver: path escapes assetsRoot via '..' which is not allowed",
@@ -65,7 +224,7 @@ namespace Engine::Asset::Resolver {
             );
         }
 
-        return Base::Result<std::string, AssetError>::Ok(std::move(cleaned));;
+        return R::Ok(std::string_view(out).substr(base));
     }
 
     std::string AssetPathResolver::NormalizePath(std::string_view path,
@@ -74,157 +233,12 @@ namespace Engine::Asset::Resolver {
         std::string out;
         out.reserve(path.size());
 
-        bool prevSlash = false;
-        for (char c : path) {
-            char x = c;
-
-            if (normalizeSeparators && x == '\\') x = '/';
-
-            const bool isSlash = (x == '/');
-            if (squashSlashes) {
-                if (isSlash) {
-                    if (prevSlash) continue;
-                    prevSlash = true;
-                } else {
-                    prevSlash = false;
-                }
-            }
-            out.push_back(x);
-        }
+        NormalizedReader reader(normalizeSeparators, squashSlashes);
+        reader.Add(path);
+        for (char c; reader.Next(c);) out.push_back(c);
 
         // 末尾の "/" は原則保持（ただし空や "/" 単体などはそのまま）
         return out;
     }
 
-    bool AssetPathResolver::IsAbsolutePath(std::string_view p) {
-        if (p.empty()) return false;
-
-        // Unix: "/..."
-        if (p.size() >= 1 && p[0] == '/') return true;
-
-        // Windows UNC: "\\server\share" は Normalize 前でも来るので両方対応
-        if (p.size() >= 2 && IsSlash(p[0]) && IsSlash(p[1])) return true;
-
-        // Windows drive: "C:\..." or "C:/..."
-        if (p.size() >= 3 &&
-            std::isalpha(static_cast<unsigned char>(p[0])) &&
-            p[1] == ':' &&
-            IsSlash(p[2])) {
-            return true;
-        }
-        return false;
-    }
-
-    std::string AssetPathResolver::StripScheme(std::string_view p, bool& stripped) {
-        stripped = false;
-
-        // 例: "res://textures/a.png"
-        // 例: "assets://textures/a.png"
-        auto pos = p.find("://");
-        if (pos == std::string_view::npos) {
-            return std::string(p);
-        }
-
-        // scheme 名は検証しない（許可するなら剥がす方針）
-        stripped = true;
-
-        // "://"" の直後
-        std::string_view rest = p.substr(pos + 3);
-
-        // "res:///a" のようなケースを "a" に寄せる（先頭スラッシュ削除）
-        while (!rest.empty() && (rest.front() == '/' || rest.front() == '\\')) {
-            rest.remove_prefix(1);
-        }
-        return std::string(rest);
-    }
-
-    std::string AssetPathResolver::JoinRootAndRelative(std::string_view root, std::string_view rel) {
-        std::string r = std::string(root);
-        if (r.empty()) r = "assets";
-
-        // 正規化前提で "/" へ寄せる
-        for (auto& c : r) {
-            if (c == '\\') c = '/';
-        }
-
-        // root の末尾が "/" で終わるようにする
-        if (!r.empty() && r.back() != '/') r.push_back('/');
-
-        // rel 先頭の "/" を除く（相対のはずだが保険）
-        while (!rel.empty() && IsSlash(rel.front())) rel.remove_prefix(1);
-
-        r.append(rel.data(), rel.size());
-        return r;
-    }
-
-    std::string AssetPathResolver::RemoveDotSegments(std::string_view path, bool& escapedAboveRoot) {
-        escapedAboveRoot = false;
-
-        // "/" 区切り想定（NormalizePath で揃っている前提）
-        // ただし Windows drive/UNC も来るので prefix を扱う
-        std::string prefix;
-        std::string_view p = path;
-
-        // drive prefix "C:/"
-        if (p.size() >= 3 &&
-            std::isalpha(static_cast<unsigned char>(p[0])) &&
-            p[1] == ':' &&
-            p[2] == '/') {
-            prefix = std::string(p.substr(0, 3)); // "C:/"
-            p.remove_prefix(3);
-        }
-        // UNC prefix "//server/share/" は簡易対応：先頭 "//" を prefix として保持
-        else if (p.size() >= 2 && p[0] == '/' && p[1] == '/') {
-            prefix = "//";
-            p.remove_prefix(2);
-        }
-        // unix absolute "/" を prefix として保持
-        else if (!p.empty() && p[0] == '/') {
-            prefix = "/";
-            p.remove_prefix(1);
-        }
-
-        std::vector<std::string> stack;
-        stack.reserve(16);
-
-        size_t i = 0;
-        while (i <= p.size()) {
-            size_t j = p.find('/', i);
-            if (j == std::string_view::npos) j = p.size();
-
-            std::string_view seg = p.substr(i, j - i);
-            i = j + 1;
-
-            if (seg.empty() || seg == ".") {
-                continue;
-            }
-            if (seg == "..") {
-                if (!stack.empty()) {
-                    stack.pop_back();
-                } else {
-                    // ルートより上に出ようとした
-                    escapedAboveRoot = true;
-                }
-                continue;
-            }
-
-            stack.emplace_back(seg);
-        }
-
-        std::string out = prefix;
-        for (size_t k = 0; k < stack.size(); ++k) {
-            if (!out.empty() && out.back() != '/') out.push_back('/');
-            out += stack[k];
-        }
-
-        // prefix が "/" で stack が空のときは "/" を返す（絶対パスのルート）
-        if (!prefix.empty() && stack.empty()) {
-            // "C:/" や "/" を維持
-            return out.empty() ? prefix : out;
-        }
-
-        // 相対で空になった場合は空文字を返す（呼び出し元で扱う）
-        return out;
-    }
-
 } // namespace Engine::Asset::Resolver
@@ -1,5 +1,10 @@
 #include "engine/asset/loading/AssetPipeline.hpp"
 
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
 #include "engine/asset/core/AssetStatistics.hpp" // optional（nullptrなら使わない）
 
 namespace Engine::Asset::Loading {
@@ -7,11 +12,14 @@ namespace Engine::Asset::Loading {
     AssetPipeline::AssetPipeline(IAssetSource& source, LoaderRegistry& registry)
         : source_(source), registry_(registry) {}
 
-    Base::Result<Core::AnyAsset, AssetError>
-    AssetPipeline::Load(const LoadContext& ctx) {
+    AssetPipeline::AssetPipeline(IAssetSource& source, LoaderRegistry& registry, Options opt)
+        : source_(source), registry_(registry), opt_(opt) {}
+
+    Base::Result<IAssetLoader*, AssetError>
+    AssetPipeline::Prepare_(const LoadContext& ctx) {
         // 0) 基本検証
         if (!ctx.HasPath()) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
+            return Base::Result<IAssetLoader*, AssetError>::Err(
                 AssetError::Make(AssetErrorCode::InvalidPath, "AssetPipeline: resolvedPath is empty"));
         }
 
@@ -25,24 +33,32 @@ namespace Engine::Asset::Loading {
             if (ctx.statistics) {
                 ctx.statistics->OnLoadFailure(ctx.id, ctx.type, ctx.nowFrame);
             }
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
+            return Base::Result<IAssetLoader*, AssetError>::Err(
                 AssetError::Make(AssetErrorCode::UnsupportedType, "AssetPipeline: no loader for type", ctx.resolvedPath));
         }
+        return Base::Result<IAssetLoader*, AssetError>::Ok(loader);
+    }
 
-        // 2) bytes を読む
-        auto bytesR = source_.ReadAll(ctx.resolvedPath);
-        if (!bytesR) {
+    Base::Result<Core::AnyAsset, AssetError>
+    AssetPipeline::Decode_(IAssetLoader& loader,
+                           Base::Result<SourceView, AssetError>&& viewR,
+                           const LoadContext& ctx,
+                           LoadReport* report) {
+        if (!viewR) {
             if (ctx.statistics) {
                 ctx.statistics->OnLoadFailure(ctx.id, ctx.type, ctx.nowFrame);
             }
-            return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(bytesR.error()));
+            return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(viewR.error()));
         }
 
-        auto& buf = bytesR.value();
-        Detail::ConstSpan<std::byte> bytes{ buf.data(), buf.size() };
+        const SourceView& view = viewR.value();
+        const std::uint64_t bytesRead = static_cast<std::uint64_t>(view.bytes.size());
+        if (report) {
+            report->bytesRead = bytesRead;
+        }
 
         // 3) decode/parse
-        auto assetR = loader->Load(bytes, ctx);
+        auto assetR = loader.LoadView(view, ctx);
         if (!assetR) {
             if (ctx.statistics) {
                 ctx.statistics->OnLoadFailure(ctx.id, ctx.type, ctx.nowFrame);
@@ -50,13 +66,128 @@ namespace Engine::Asset::Loading {
             return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(assetR.error()));
         }
 
+        const std::uint64_t resident = loader.ResidentBytes(assetR.value());
+        if (report) {
+            report->decodedBytes = resident;
+        }
         if (ctx.statistics) {
-            ctx.statistics->OnLoadSuccess(ctx.id, ctx.type, ctx.nowFrame,
-                                          static_cast<std::uint64_t>(buf.size()),
-                                          0 /*decodedBytes: 分かるなら loader で埋める*/);
+            ctx.statistics->OnLoadSuccess(ctx.id, ctx.type, ctx.nowFrame, bytesRead, resident);
         }
 
         return Base::Result<Core::AnyAsset, AssetError>::Ok(std::move(assetR.value()));
     }
 
+    Base::Result<Core::AnyAsset, AssetError>
+    AssetPipeline::LoadStream_(IAssetLoader& loader, const LoadContext& ctx, LoadReport* report) {
+        auto fail = [&](AssetError&& e) {
+            if (ctx.statistics) {
+                ctx.statistics->OnLoadFailure(ctx.id, ctx.type, ctx.nowFrame);
+            }
+            return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(e));
+        };
+
+        std::unique_ptr<IStreamDecoder> decoder;
+        std::optional<AssetError> feedError;
+        std::uint64_t bytesRead = 0;
+
+        // 2) 読みながら decode（decoder はサイズが分かった時点で作る）
+        auto readR = source_.ReadChunks(ctx.resolvedPath, opt_.streamChunkBytes,
+            [&](Detail::ConstSpan<std::byte> chunk, std::uint64_t totalBytes) {
+                if (!decoder) {
+                    decoder = loader.BeginStream(ctx, totalBytes);
+                    if (!decoder) {
+                        feedError = AssetError::Make(AssetErrorCode::InternalError,
+                                                     "AssetPipeline: loader refused to stream", ctx.resolvedPath);
+                        return false;
+                    }
+                }
+                bytesRead += chunk.size();
+                auto fed = decoder->Feed(chunk);
+                if (!fed) {
+                    feedError = std::move(fed.error());
+                    return false;
+                }
+                return decoder->NeedsMoreInput();
+            });
+
+        if (report) {
+            report->bytesRead = bytesRead;
+        }
+        if (!readR) return fail(std::move(readR.error()));
+        if (feedError) return fail(std::move(*feedError));
+        if (!decoder) {
+            return fail(AssetError::Make(AssetErrorCode::InternalError,
+                                         "AssetPipeline: source produced no chunk", ctx.resolvedPath));
+        }
+
+        // 3) 終端
+        auto assetR = decoder->Finish();
+        if (!assetR) return fail(std::move(assetR.error()));
+
+        const std::uint64_t resident = loader.ResidentBytes(assetR.value());
+        if (report) {
+            report->decodedBytes = resident;
+        }
+        if (ctx.statistics) {
+            ctx.statistics->OnLoadSuccess(ctx.id, ctx.type, ctx.nowFrame, bytesRead, resident);
+        }
+        return Base::Result<Core::AnyAsset, AssetError>::Ok(std::move(assetR.value()));
+    }
+
+    bool AssetPipeline::UsesStream_(const IAssetLoader& loader) const noexcept {
+        return opt_.streamChunkBytes > 0 && loader.SupportsStreaming() && !source_.HasZeroCopyViews();
+    }
+
+    Base::Result<Core::AnyAsset, AssetError>
+    AssetPipeline::Load(const LoadContext& ctx, LoadReport* report) {
+        auto loaderR = Prepare_(ctx);
+        if (!loaderR) return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(loaderR.error()));
+
+        IAssetLoader& loader = *loaderR.value();
+        if (UsesStream_(loader)) {
+            return LoadStream_(loader, ctx, report);
+        }
+
+        // 2) bytes を読む（借用ビュー：mmap 等ならコピー無し）
+        return Decode_(loader, source_.ReadView(ctx.resolvedPath), ctx, report);
+    }
+
+    void AssetPipeline::LoadMany(Detail::ConstSpan<LoadContext> ctxs, const LoadCallback& onComplete) {
+        // 検証に通ったものだけを 1 バッチで読む
+        // 増分 decode する loader はバッチに入れない（全体を読むと sound_stream などが
+        // ヘッダだけで済むはずの入力を丸ごと抱える）：Load と同じくチャンク読みで decode する
+        std::vector<std::string_view> paths;
+        std::vector<std::size_t> indices;
+        std::vector<IAssetLoader*> loaders;
+        paths.reserve(ctxs.size());
+        indices.reserve(ctxs.size());
+        loaders.reserve(ctxs.size());
+
+        for (std::size_t i = 0; i < ctxs.size(); ++i) {
+            auto loaderR = Prepare_(ctxs[i]);
+            if (!loaderR) {
+                onComplete(i, Base::Result<Core::AnyAsset, AssetError>::Err(std::move(loaderR.error())), LoadReport{});
+                continue;
+            }
+            if (UsesStream_(*loaderR.value())) {
+                LoadReport report{};
+                auto r = LoadStream_(*loaderR.value(), ctxs[i], &report);
+                onComplete(i, std::move(r), report);
+                continue;
+            }
+            paths.push_back(ctxs[i].resolvedPath);
+            indices.push_back(i);
+            loaders.push_back(loaderR.value());
+        }
+        if (paths.empty()) return;
+
+        source_.ReadMany(Detail::ConstSpan<std::string_view>{ paths.data(), paths.size() },
+            [&](std::size_t k, Base::Result<SourceView, AssetError>&& viewR) {
+                const std::size_t i = indices[k];
+                LoadReport report{};
+                auto r = Decode_(*loaders[k], std::move(viewR), ctxs[i], &report);
+                onComplete(i, std::move(r), report);
+            });
+    }
+
 } // namespace Engine::Asset::Loading
@@ -0,0 +1,125 @@
+#include "engine/asset/loading/AssetWorkerPool.hpp"
+
+#include <utility>
+
+namespace Engine::Asset::Loading {
+
+    AssetWorkerPool::AssetWorkerPool(AssetPipeline& pipeline, std::uint32_t threadCount)
+        : pipeline_(pipeline) {
+        if (threadCount == 0) threadCount = 1;
+        threads_.reserve(threadCount);
+        for (std::uint32_t i = 0; i < threadCount; ++i) {
+            threads_.emplace_back([this] { WorkerMain_(); });
+        }
+    }
+
+    AssetWorkerPool::~AssetWorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            stopping_ = true;
+            // 未着手の job は捨てる（終了を待たせない）
+            for (const auto& b : batches_) inFlight_ -= b.size();
+            batches_.clear();
+        }
+        workCv_.notify_all();
+        for (auto& t : threads_) {
+            if (t.joinable()) t.join();
+        }
+    }
+
+    void AssetWorkerPool::Submit(Job job) {
+        std::vector<Job> batch;
+        batch.push_back(std::move(job));
+        SubmitBatch(std::move(batch));
+    }
+
+    void AssetWorkerPool::SubmitBatch(std::vector<Job> jobs) {
+        if (jobs.empty()) return;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            inFlight_ += jobs.size();
+            batches_.push_back(std::move(jobs));
+        }
+        workCv_.notify_one();
+    }
+
+    std::size_t AssetWorkerPool::DrainCompleted(std::vector<Completion>& out) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        const std::size_t n = done_.size();
+        for (auto& c : done_) out.push_back(std::move(c));
+        done_.clear();
+        inFlight_ -= n;
+        return n;
+    }
+
+    void AssetWorkerPool::WaitIdle() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        idleCv_.wait(lock, [this] { return batches_.empty() && running_ == 0; });
+    }
+
+    std::size_t AssetWorkerPool::InFlight() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return inFlight_;
+    }
+
+    void AssetWorkerPool::WorkerMain_() {
+        while (true) {
+            std::vector<Job> batch;
+            {
+                std::unique_lock<std::mutex> lock(mtx_);
+                workCv_.wait(lock, [this] { return stopping_ || !batches_.empty(); });
+                if (stopping_) return;
+                batch = std::move(batches_.front());
+                batches_.pop_front();
+                ++running_;
+            }
+
+            RunBatch_(batch);
+
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+                --running_;
+                if (batches_.empty() && running_ == 0) idleCv_.notify_all();
+            }
+        }
+    }
+
+    void AssetWorkerPool::RunBatch_(std::vector<Job>& batch) {
+        // statistics は main thread 専用：計測値は report で持ち帰る
+        for (auto& job : batch) {
+            job.ctx.request = &job.request;
+            job.ctx.statistics = nullptr;
+        }
+
+        auto complete = [&](std::size_t i, Base::Result<Core::AnyAsset, AssetError>&& r, const LoadReport& report) {
+            Job& job = batch[i];
+            std::lock_guard<std::mutex> lock(mtx_);
+            done_.push_back(Completion{
+                job.ctx.id,
+                job.ctx.type,
+                std::move(job.ctx.resolvedPath),
+                std::move(job.request),
+                report,
+                std::move(r)
+            });
+        };
+
+        if (batch.size() == 1) {
+            LoadReport report{};
+            auto r = pipeline_.Load(batch.front().ctx, &report);
+            complete(0, std::move(r), report);
+            return;
+        }
+
+        // LoadContext だけの連続配列にして LoadMany へ（ctx.request は batch 側を指したまま）
+        std::vector<LoadContext> ctxs;
+        ctxs.reserve(batch.size());
+        for (const auto& job : batch) ctxs.push_back(job.ctx);
+
+        pipeline_.LoadMany(Detail::ConstSpan<LoadContext>{ ctxs.data(), ctxs.size() },
+            [&](std::size_t i, Base::Result<Core::AnyAsset, AssetError>&& r, const LoadReport& report) {
+                complete(i, std::move(r), report);
+            });
+    }
+
+} // namespace Engine::Asset::Loading
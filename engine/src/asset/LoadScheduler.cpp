@@ -0,0 +1,151 @@
+#include "engine/asset/loading/LoadScheduler.hpp"
+
+#include <utility>
+
+namespace Engine::Asset::Loading {
+
+    void LoadScheduler::SetOptions(Options opt) {
+        opt_ = opt;
+        for (auto& e : heap_) {
+            e.key = KeyOf_(e.req.priority, e.enqueueFrame);
+        }
+        // 並びが変わるので組み直す
+        for (std::size_t i = heap_.size() / 2; i-- > 0;) {
+            SiftDown_(i);
+        }
+    }
+
+    bool LoadScheduler::Push(const AssetId& id, const AssetRequest& req, std::uint64_t nowFrame) {
+        auto it = index_.find(id);
+        if (it != index_.end()) {
+            const std::size_t i = it->second;
+            Entry& e = heap_[i];
+
+            const std::int32_t prio = (req.priority > e.req.priority) ? req.priority : e.req.priority;
+
+            // Reload 要求は後勝ち（旧要求が Auto でも再読み込みさせる）
+            if (req.IsReload()) {
+                e.req = req;
+            }
+            e.req.priority = prio;
+
+            // 待ち時間（enqueueFrame）は維持したまま順位だけ上げる
+            const std::int64_t newKey = KeyOf_(prio, e.enqueueFrame);
+            if (newKey > e.key) {
+                e.key = newKey;
+                SiftUp_(i);
+            }
+            return false;
+        }
+
+        Entry e;
+        e.id = id;
+        e.req = req;
+        e.enqueueFrame = nowFrame;
+        e.key = KeyOf_(req.priority, nowFrame);
+        e.seq = ++seq_;
+
+        heap_.push_back(std::move(e));
+        index_[id] = heap_.size() - 1;
+        SiftUp_(heap_.size() - 1);
+        return true;
+    }
+
+    bool LoadScheduler::Pop(Entry& out) {
+        if (heap_.empty()) return false;
+
+        Swap_(0, heap_.size() - 1);
+        out = std::move(heap_.back());
+        heap_.pop_back();
+        index_.erase(out.id);
+
+        if (!heap_.empty()) SiftDown_(0);
+        return true;
+    }
+
+    void LoadScheduler::Restore(Entry e) {
+        if (Contains(e.id)) {
+            // 戻す前に同じ id が再投入されていたらマージ扱い
+            Push(e.id, e.req, e.enqueueFrame);
+            return;
+        }
+        const AssetId id = e.id;
+        heap_.push_back(std::move(e));
+        index_[id] = heap_.size() - 1;
+        SiftUp_(heap_.size() - 1);
+    }
+
+    bool LoadScheduler::Erase(const AssetId& id) {
+        auto it = index_.find(id);
+        if (it == index_.end()) return false;
+        RemoveAt_(it->second);
+        return true;
+    }
+
+    const LoadScheduler::Entry* LoadScheduler::Find(const AssetId& id) const noexcept {
+        auto it = index_.find(id);
+        return (it == index_.end()) ? nullptr : &heap_[it->second];
+    }
+
+    void LoadScheduler::Clear() {
+        heap_.clear();
+        index_.clear();
+    }
+
+    std::int64_t LoadScheduler::KeyOf_(std::int32_t priority, std::uint64_t enqueueFrame) const noexcept {
+        if (opt_.agingFrames == 0) return static_cast<std::int64_t>(priority);
+        return static_cast<std::int64_t>(priority) * static_cast<std::int64_t>(opt_.agingFrames)
+             - static_cast<std::int64_t>(enqueueFrame);
+    }
+
+    bool LoadScheduler::Before_(const Entry& a, const Entry& b) noexcept {
+        if (a.key != b.key) return a.key > b.key;
+        return a.seq < b.seq; // 同順位は FIFO
+    }
+
+    void LoadScheduler::SiftUp_(std::size_t i) {
+        while (i > 0) {
+            const std::size_t parent = (i - 1) / 2;
+            if (!Before_(heap_[i], heap_[parent])) break;
+            Swap_(i, parent);
+            i = parent;
+        }
+    }
+
+    void LoadScheduler::SiftDown_(std::size_t i) {
+        const std::size_t n = heap_.size();
+        while (true) {
+            const std::size_t l = i * 2 + 1;
+            const std::size_t r = l + 1;
+            std::size_t best = i;
+            if (l < n && Before_(heap_[l], heap_[best])) best = l;
+            if (r < n && Before_(heap_[r], heap_[best])) best = r;
+            if (best == i) break;
+            Swap_(i, best);
+            i = best;
+        }
+    }
+
+    void LoadScheduler::Swap_(std::size_t a, std::size_t b) {
+        std::swap(heap_[a], heap_[b]);
+        index_[heap_[a].id] = a;
+        index_[heap_[b].id] = b;
+    }
+
+    void LoadScheduler::RemoveAt_(std::size_t i) {
+        index_.erase(heap_[i].id);
+
+        const std::size_t last = heap_.size() - 1;
+        if (i != last) {
+            heap_[i] = std::move(heap_[last]);
+            index_[heap_[i].id] = i;
+        }
+        heap_.pop_back();
+
+        if (i < heap_.size()) {
+            SiftDown_(i);
+            SiftUp_(i);
+        }
+    }
+
+} // namespace Engine::Asset::Loading
@@ -0,0 +1,211 @@
+#include "engine/asset/catalog/CatalogCompiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "engine/asset/AssetCatalog.hpp"
+#include "engine/asset/catalog/CompiledCatalogFormat.hpp"
+
+namespace Engine::Asset::Catalog {
+
+    namespace {
+        using namespace Compiled;
+
+        // bucket あたりの平均キー数（大きいほど seed 表は小さく、構築は遅くなる）
+        constexpr std::uint32_t kKeysPerBucket = 3;
+        // 1 bucket で試す seed の上限（kDirectSlot のビットとは重ならないこと）
+        constexpr std::uint32_t kMaxSeed = 1u << 24;
+        // 置けない bucket があったら salt を変えてやり直す回数
+        constexpr int kMaxAttempts = 8;
+
+        std::uint64_t AlignUp(std::uint64_t v, std::uint64_t a) noexcept {
+            return (v + (a - 1)) & ~(a - 1);
+        }
+
+        // CHD：キーの多い bucket から順に、全キーが空き slot に落ちる seed を探す
+        // - 1 キーの bucket は最後に空き slot を直接割り当てる（表が埋まってからの総当たりを避ける）
+        // - slotOfKey[i] = keys[i] の置き場所
+        bool Place(const std::vector<std::uint64_t>& keys, std::uint64_t salt, std::uint32_t bucketCount,
+                   std::vector<std::uint32_t>& seeds, std::vector<std::uint32_t>& slotOfKey) {
+            const std::uint32_t n = static_cast<std::uint32_t>(keys.size());
+
+            // bucket ごとにキーを並べる（counting sort）
+            std::vector<std::uint32_t> start(bucketCount + 1, 0);
+            std::vector<std::uint32_t> bucketOfKey(n);
+            for (std::uint32_t i = 0; i < n; ++i) {
+                bucketOfKey[i] = BucketOf(keys[i], salt, bucketCount);
+                ++start[bucketOfKey[i] + 1];
+            }
+            for (std::uint32_t b = 0; b < bucketCount; ++b) start[b + 1] += start[b];
+            std::vector<std::uint32_t> members(n);
+            {
+                std::vector<std::uint32_t> cursor(start.begin(), start.end() - 1);
+                for (std::uint32_t i = 0; i < n; ++i) members[cursor[bucketOfKey[i]]++] = i;
+            }
+
+            std::vector<std::uint32_t> order(bucketCount);
+            for (std::uint32_t b = 0; b < bucketCount; ++b) order[b] = b;
+            std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+                return start[a + 1] - start[a] > start[b + 1] - start[b];
+            });
+
+            seeds.assign(bucketCount, 0);
+            slotOfKey.assign(n, 0);
+            std::vector<std::uint8_t> taken(n, 0);
+            std::vector<std::uint32_t> trial;
+            std::uint32_t nextFree = 0;
+
+            for (std::uint32_t b : order) {
+                const std::uint32_t* m = members.data() + start[b];
+                const std::uint32_t size = start[b + 1] - start[b];
+                if (size == 0) break; // 以降も空
+
+                if (size == 1) {
+                    while (taken[nextFree]) ++nextFree;
+                    taken[nextFree] = 1;
+                    seeds[b] = kDirectSlot | nextFree;
+                    slotOfKey[m[0]] = nextFree;
+                    continue;
+                }
+
+                bool placed = false;
+                for (std::uint32_t seed = 0; seed < kMaxSeed && !placed; ++seed) {
+                    trial.clear();
+                    bool ok = true;
+                    for (std::uint32_t k = 0; k < size && ok; ++k) {
+                        const std::uint32_t s = SlotOf(keys[m[k]], salt, seed, n);
+                        ok = !taken[s] && std::find(trial.begin(), trial.end(), s) == trial.end();
+                        trial.push_back(s);
+                    }
+                    if (!ok) continue;
+
+                    for (std::uint32_t k = 0; k < size; ++k) {
+                        taken[trial[k]] = 1;
+                        slotOfKey[m[k]] = trial[k];
+                    }
+                    seeds[b] = seed;
+                    placed = true;
+                }
+                if (!placed) return false;
+            }
+            return true;
+        }
+    }
+
+    Base::Result<void, AssetError> CatalogCompiler::Add(const CatalogEntry& entry) {
+        if (!entry.id.IsValid() || entry.resolvedPath.empty()) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "CatalogCompiler: invalid id or path", entry.sourcePath));
+        }
+        if (!idKeys_.insert(entry.id.value).second) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "CatalogCompiler: duplicated id", entry.sourcePath));
+        }
+
+        Item item;
+        item.idKey = entry.id.value;
+        item.typeKey = entry.type.value;
+        item.sourcePath = entry.sourcePath;
+        item.resolvedPath = entry.resolvedPath;
+        items_.push_back(std::move(item));
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+    Base::Result<void, AssetError> CatalogCompiler::AddCatalog(const AssetCatalog& catalog) {
+        for (const auto* e : catalog.Entries()) {
+            auto added = Add(*e);
+            if (!added) return added;
+        }
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+    Base::Result<Loading::ByteBuffer, AssetError> CatalogCompiler::Build() const {
+        auto fail = [](const char* msg) {
+            return Base::Result<Loading::ByteBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InternalError, msg, ""));
+        };
+
+        if (items_.size() >= kDirectSlot) return fail("CatalogCompiler: too many entries");
+        const std::uint32_t n = static_cast<std::uint32_t>(items_.size());
+
+        // 1) 最小完全ハッシュ
+        std::vector<std::uint64_t> keys(n);
+        for (std::uint32_t i = 0; i < n; ++i) keys[i] = items_[i].idKey;
+
+        Header h;
+        h.entryCount = n;
+        h.bucketCount = n == 0 ? 0 : (n + kKeysPerBucket - 1) / kKeysPerBucket;
+
+        std::vector<std::uint32_t> seeds;
+        std::vector<std::uint32_t> slotOfKey;
+        bool placed = n == 0;
+        for (int attempt = 0; attempt < kMaxAttempts && !placed; ++attempt) {
+            h.salt = Mix64(0x4F54435400000000ull + static_cast<std::uint64_t>(attempt));
+            placed = Place(keys, h.salt, h.bucketCount, seeds, slotOfKey);
+        }
+        if (!placed) return fail("CatalogCompiler: perfect hash construction failed");
+
+        // 2) string pool（登録順。各文字列の後ろに '\0'）
+        std::vector<Entry> entries(n);
+        std::string pool;
+        auto intern = [&](const std::string& s, std::uint32_t& off, std::uint32_t& len) {
+            off = static_cast<std::uint32_t>(pool.size());
+            len = static_cast<std::uint32_t>(s.size());
+            pool += s;
+            pool.push_back('\0');
+        };
+        for (std::uint32_t i = 0; i < n; ++i) {
+            Entry& e = entries[slotOfKey[i]];
+            e.idKey = items_[i].idKey;
+            e.typeKey = items_[i].typeKey;
+            intern(items_[i].sourcePath, e.sourceOffset, e.sourceLength);
+            intern(items_[i].resolvedPath, e.resolvedOffset, e.resolvedLength);
+            if (pool.size() > std::numeric_limits<std::uint32_t>::max()) return fail("CatalogCompiler: string pool too large");
+        }
+
+        // 3) 配置
+        h.seedsOffset = kHeaderSize;
+        h.entriesOffset = AlignUp(h.seedsOffset + std::uint64_t{ h.bucketCount } * kSeedSize, 8);
+        h.stringsOffset = h.entriesOffset + std::uint64_t{ n } * kEntrySize;
+        h.stringsSize = pool.size();
+
+        // 4) 書き出し
+        Loading::ByteBuffer out(static_cast<std::size_t>(h.stringsOffset + h.stringsSize), std::byte{ 0 });
+        WriteHeader(out.data(), h);
+
+        std::byte* p = out.data() + h.seedsOffset;
+        for (std::uint32_t s : seeds) {
+            StoreU32(p, s);
+            p += kSeedSize;
+        }
+        p = out.data() + h.entriesOffset;
+        for (const auto& e : entries) {
+            WriteEntry(p, e);
+            p += kEntrySize;
+        }
+        if (!pool.empty()) std::memcpy(out.data() + h.stringsOffset, pool.data(), pool.size());
+
+        return Base::Result<Loading::ByteBuffer, AssetError>::Ok(std::move(out));
+    }
+
+    Base::Result<void, AssetError> CatalogCompiler::WriteToFile(std::string_view path) const {
+        auto built = Build();
+        if (!built) return Base::Result<void, AssetError>::Err(std::move(built.error()));
+
+        const auto& bytes = built.value();
+        std::ofstream ofs(std::string(path), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "CatalogCompiler: cannot open output", std::string(path)));
+        }
+        ofs.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!ofs) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "CatalogCompiler: write failed", std::string(path)));
+        }
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+} // namespace Engine::Asset::Catalog
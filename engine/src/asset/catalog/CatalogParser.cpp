@@ -1,43 +1,401 @@
 #include "engine/asset/catalog/CatalogParser.hpp"
 
-#include <nlohmann/json.hpp>
+#include <cstdint>
+
+#include "engine/asset/catalog/CatalogFormat.hpp"
 
 namespace Engine::Asset::Catalog {
 
-    Base::Result<std::vector<RawCatalogEntry>, AssetError>
-    CatalogParser::Parse(std::string_view catalogText, std::string_view sourceName) {
-        using json = nlohmann::json;
+    namespace {
+
+        // 入れ子の上限（壊れた / 悪意のある入力でスタックを使い切らないため）
+        constexpr int kMaxDepth = 256;
+
+        // JsonReader：catalogText を先頭から 1 回だけなめる最小の JSON 字句読み
+        // - 文字列は可能な限り catalogText への string_view で返す
+        // - 構文エラーは false を返すだけ（メッセージは呼び出し側で 1 種類にまとめる）
+        class JsonReader final {
+        public:
+            JsonReader(std::string_view text, std::deque<std::string>& unescaped) noexcept
+                : p_(text.data()), end_(text.data() + text.size()), unescaped_(unescaped) {
+                // UTF-8 BOM は読み飛ばす
+                if (end_ - p_ >= 3 && static_cast<unsigned char>(p_[0]) == 0xEF &&
+                    static_cast<unsigned char>(p_[1]) == 0xBB && static_cast<unsigned char>(p_[2]) == 0xBF) {
+                    p_ += 3;
+                }
+            }
+
+            void SkipWs() noexcept {
+                while (p_ != end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r')) ++p_;
+            }
+
+            bool AtEnd() noexcept {
+                SkipWs();
+                return p_ == end_;
+            }
+
+            // 空白の次の 1 文字（終端なら '\0'）
+            char Peek() noexcept {
+                SkipWs();
+                return p_ == end_ ? '\0' : *p_;
+            }
+
+            bool Consume(char c) noexcept {
+                if (Peek() != c) return false;
+                ++p_;
+                return true;
+            }
+
+            // object / array の要素区切り：',' なら次へ、close なら終わり（more = false）
+            bool NextOrClose(char close, bool& more) noexcept {
+                const char c = Peek();
+                if (c == ',') { ++p_; more = true; return true; }
+                if (c == close) { ++p_; more = false; return true; }
+                return false;
+            }
+
+            bool ReadString(std::string_view& out) {
+                if (!Consume('"')) return false;
+                const char* begin = p_;
+                while (p_ != end_) {
+                    const char c = *p_;
+                    if (c == '"') {
+                        out = std::string_view(begin, static_cast<std::size_t>(p_ - begin));
+                        ++p_;
+                        return true;
+                    }
+                    if (c == '\\') return ReadEscaped_(begin, out);
+                    if (static_cast<unsigned char>(c) < 0x20) return false;
+                    ++p_;
+                }
+                return false;
+            }
+
+            // 整数なら value に入れて isInt = true。小数 / 指数 / 範囲外は isInt = false（構文が正しければ true を返す）
+            bool ReadNumber(bool& isInt, std::int64_t& value) noexcept {
+                SkipWs();
+                isInt = true;
+                value = 0;
+                bool negative = false;
+                if (p_ != end_ && *p_ == '-') { negative = true; ++p_; }
+                if (p_ == end_ || !IsDigit(*p_)) return false;
+                if (*p_ == '0') {
+                    ++p_;
+                } else {
+                    while (p_ != end_ && IsDigit(*p_)) {
+                        if (value > (INT64_MAX - 9) / 10) isInt = false;
+                        if (isInt) value = value * 10 + (*p_ - '0');
+                        ++p_;
+                    }
+                }
+                if (p_ != end_ && *p_ == '.') {
+                    isInt = false;
+                    ++p_;
+                    if (p_ == end_ || !IsDigit(*p_)) return false;
+                    while (p_ != end_ && IsDigit(*p_)) ++p_;
+                }
+                if (p_ != end_ && (*p_ == 'e' || *p_ == 'E')) {
+                    isInt = false;
+                    ++p_;
+                    if (p_ != end_ && (*p_ == '+' || *p_ == '-')) ++p_;
+                    if (p_ == end_ || !IsDigit(*p_)) return false;
+                    while (p_ != end_ && IsDigit(*p_)) ++p_;
+                }
+                if (negative) value = -value;
+                return true;
+            }
+
+            // 値を 1 つ読み捨てる（構文チェックはする）
+            bool SkipValue(int depth = 0) {
+                if (depth > kMaxDepth) return false;
+                switch (Peek()) {
+                case '"': {
+                    std::string_view s;
+                    return ReadString(s);
+                }
+                case '{': {
+                    ++p_;
+                    if (Peek() == '}') { ++p_; return true; }
+                    for (bool more = true; more;) {
+                        std::string_view key;
+                        if (!ReadString(key) || !Consume(':') || !SkipValue(depth + 1)) return false;
+                        if (!NextOrClose('}', more)) return false;
+                    }
+                    return true;
+                }
+                case '[': {
+                    ++p_;
+                    if (Peek() == ']') { ++p_; return true; }
+                    for (bool more = true; more;) {
+                        if (!SkipValue(depth + 1)) return false;
+                        if (!NextOrClose(']', more)) return false;
+                    }
+                    return true;
+                }
+                case 't': return ReadLiteral_("true");
+                case 'f': return ReadLiteral_("false");
+                case 'n': return ReadLiteral_("null");
+                default: {
+                    bool isInt = false;
+                    std::int64_t v = 0;
+                    return ReadNumber(isInt, v);
+                }
+                }
+            }
+
+        private:
+            static bool IsDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+            static int HexValue(char c) noexcept {
+                if (c >= '0' && c <= '9') return c - '0';
+                if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+                if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+                return -1;
+            }
+
+            bool ReadLiteral_(std::string_view lit) noexcept {
+                if (static_cast<std::size_t>(end_ - p_) < lit.size() || std::string_view(p_, lit.size()) != lit) return false;
+                p_ += lit.size();
+                return true;
+            }
+
+            bool ReadHex4_(std::uint32_t& cp) noexcept {
+                if (end_ - p_ < 4) return false;
+                cp = 0;
+                for (int i = 0; i < 4; ++i) {
+                    const int h = HexValue(p_[i]);
+                    if (h < 0) return false;
+                    cp = (cp << 4) | static_cast<std::uint32_t>(h);
+                }
+                p_ += 4;
+                return true;
+            }
+
+            static void AppendUtf8(std::string& s, std::uint32_t cp) {
+                if (cp < 0x80) {
+                    s.push_back(static_cast<char>(cp));
+                } else if (cp < 0x800) {
+                    s.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+                    s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                } else if (cp < 0x10000) {
+                    s.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+                    s.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+                    s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                } else {
+                    s.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+                    s.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+                    s.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+                    s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+                }
+            }
 
-        json j;
-        try {
-            j = json::parse(catalogText.begin(), catalogText.end());
-        } catch (...) {
-            return Base::Result<std::vector<RawCatalogEntry>, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::ParseFailed, "CatalogParser: JSON parse failed", std::string(sourceName)));
+            // エスケープを含む文字列（稀）：復元して unescaped_ に置き、そちらを指す
+            bool ReadEscaped_(const char* begin, std::string_view& out) {
+                std::string s(begin, static_cast<std::size_t>(p_ - begin));
+                while (p_ != end_) {
+                    const char c = *p_++;
+                    if (c == '"') {
+                        out = unescaped_.emplace_back(std::move(s));
+                        return true;
+                    }
+                    if (static_cast<unsigned char>(c) < 0x20) return false;
+                    if (c != '\\') {
+                        s.push_back(c);
+                        continue;
+                    }
+                    if (p_ == end_) return false;
+                    switch (*p_++) {
+                    case '"': s.push_back('"'); break;
+                    case '\\': s.push_back('\\'); break;
+                    case '/': s.push_back('/'); break;
+                    case 'b': s.push_back('\b'); break;
+                    case 'f': s.push_back('\f'); break;
+                    case 'n': s.push_back('\n'); break;
+                    case 'r': s.push_back('\r'); break;
+                    case 't': s.push_back('\t'); break;
+                    case 'u': {
+                        std::uint32_t cp = 0;
+                        if (!ReadHex4_(cp)) return false;
+                        if (cp >= 0xD800 && cp <= 0xDBFF) {
+                            // サロゲートペア：続く \uDC00..DFFF と組にする
+                            std::uint32_t lo = 0;
+                            if (end_ - p_ < 2 || p_[0] != '\\' || p_[1] != 'u') return false;
+                            p_ += 2;
+                            if (!ReadHex4_(lo) || lo < 0xDC00 || lo > 0xDFFF) return false;
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                        } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                            return false;
+                        }
+                        AppendUtf8(s, cp);
+                        break;
+                    }
+                    default: return false;
+                    }
+                }
+                return false;
+            }
+
+        private:
+            const char* p_;
+            const char* end_;
+            std::deque<std::string>& unescaped_;
+        };
+
+        // ParseState：構文以外のエラーは最初の 1 件だけ覚えて最後まで読む
+        // （構文エラーがあればそちらを優先する＝DOM で全体を読んでから検査していた頃と同じ順）
+        struct ParseState final {
+            std::vector<RawCatalogEntryView> entries;
+            bool hasAssets = false;
+            bool badVersion = false;
+            bool badEntry = false;
+        };
+
+        // entry の object を読む。presetId があれば（object-form）それを id にし、中の id は無視する
+        bool ReadEntryObject(JsonReader& r, ParseState& st, std::string_view presetId, bool useKeyAsId) {
+            if (!r.Consume('{')) return false;
+
+            RawCatalogEntryView e;
+            if (useKeyAsId) e.id = presetId;
+
+            if (r.Peek() == '}') {
+                r.Consume('}');
+            } else {
+                for (bool more = true; more;) {
+                    std::string_view key;
+                    if (!r.ReadString(key) || !r.Consume(':')) return false;
+
+                    std::string_view* field = nullptr;
+                    if (key == CatalogFormat::kKeyType) field = &e.type;
+                    else if (key == CatalogFormat::kKeyPath) field = &e.path;
+                    else if (key == CatalogFormat::kKeyId && !useKeyAsId) field = &e.id;
+
+                    // 文字列以外の値は無いものとして扱う
+                    if (field && r.Peek() == '"') {
+                        if (!r.ReadString(*field)) return false;
+                    } else {
+                        if (field) *field = {};
+                        if (!r.SkipValue(2)) return false;
+                    }
+                    if (!r.NextOrClose('}', more)) return false;
+                }
+            }
+
+            if (e.id.empty() || e.type.empty() || e.path.empty()) {
+                st.badEntry = true;
+                return true;
+            }
+            st.entries.push_back(e);
+            return true;
         }
 
-        if (!j.is_object() || !j.contains("assets") || !j["assets"].is_array()) {
-            return Base::Result<std::vector<RawCatalogEntry>, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::ParseFailed, "CatalogParser: invalid schema (need { assets: [] })", std::string(sourceName)));
+        // "assets": [ { "id":..., "type":..., "path":... }, ... ]
+        bool ReadAssetsArray(JsonReader& r, ParseState& st) {
+            if (!r.Consume('[')) return false;
+            if (r.Peek() == ']') return r.Consume(']');
+            for (bool more = true; more;) {
+                if (r.Peek() == '{') {
+                    if (!ReadEntryObject(r, st, {}, false)) return false;
+                } else {
+                    // object 以外の要素は読み飛ばす
+                    if (!r.SkipValue(1)) return false;
+                }
+                if (!r.NextOrClose(']', more)) return false;
+            }
+            return true;
         }
 
-        std::vector<RawCatalogEntry> out;
-        for (const auto& a : j["assets"]) {
-            if (!a.is_object()) continue;
+        // "assets": { "<id>": { "type":..., "path":... }, ... }
+        bool ReadAssetsObject(JsonReader& r, ParseState& st) {
+            if (!r.Consume('{')) return false;
+            if (r.Peek() == '}') return r.Consume('}');
+            for (bool more = true; more;) {
+                std::string_view id;
+                if (!r.ReadString(id) || !r.Consume(':')) return false;
+                if (r.Peek() == '{') {
+                    if (!ReadEntryObject(r, st, id, true)) return false;
+                } else {
+                    if (!r.SkipValue(1)) return false;
+                }
+                if (!r.NextOrClose('}', more)) return false;
+            }
+            return true;
+        }
 
-            RawCatalogEntry e;
-            if (a.contains("id")   && a["id"].is_string())   e.id   = a["id"].get<std::string>();
-            if (a.contains("type") && a["type"].is_string()) e.type = a["type"].get<std::string>();
-            if (a.contains("path") && a["path"].is_string()) e.path = a["path"].get<std::string>();
+        bool ReadTopLevel(JsonReader& r, ParseState& st) {
+            if (r.Peek() != '{') {
+                // object 以外：構文が正しければ schema エラー（hasAssets = false のまま）
+                return r.SkipValue() && r.AtEnd();
+            }
+            r.Consume('{');
+            if (r.Peek() == '}') {
+                r.Consume('}');
+                return r.AtEnd();
+            }
+            for (bool more = true; more;) {
+                std::string_view key;
+                if (!r.ReadString(key) || !r.Consume(':')) return false;
 
-            if (e.id.empty() || e.type.empty() || e.path.empty()) {
-                return Base::Result<std::vector<RawCatalogEntry>, AssetError>::Err(
-                    AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "CatalogParser: missing id/type/path", std::string(sourceName)));
+                if (key == CatalogFormat::kKeyAssets) {
+                    // 同じキーが 2 回あれば後勝ち
+                    st.entries.clear();
+                    st.badEntry = false;
+                    st.hasAssets = true;
+                    const char c = r.Peek();
+                    bool ok = false;
+                    if (c == '[') ok = ReadAssetsArray(r, st);
+                    else if (c == '{') ok = ReadAssetsObject(r, st);
+                    else { st.hasAssets = false; ok = r.SkipValue(); }
+                    if (!ok) return false;
+                } else if (key == CatalogFormat::kKeyVersion && (r.Peek() == '-' || (r.Peek() >= '0' && r.Peek() <= '9'))) {
+                    bool isInt = false;
+                    std::int64_t v = 0;
+                    if (!r.ReadNumber(isInt, v)) return false;
+                    st.badVersion = !isInt || v != static_cast<int>(v) || !CatalogFormat::IsSupportedVersion(static_cast<int>(v));
+                } else {
+                    if (!r.SkipValue()) return false;
+                }
+                if (!r.NextOrClose('}', more)) return false;
             }
+            return r.AtEnd();
+        }
 
-            out.push_back(std::move(e));
+    } // namespace
+
+    Base::Result<std::vector<RawCatalogEntryView>, AssetError>
+    CatalogParser::ParseViews(std::string_view catalogText, std::string_view sourceName) {
+        using R = Base::Result<std::vector<RawCatalogEntryView>, AssetError>;
+        unescaped_.clear();
+
+        JsonReader reader(catalogText, unescaped_);
+        ParseState st;
+        if (!ReadTopLevel(reader, st)) {
+            return R::Err(AssetError::Make(AssetErrorCode::ParseFailed, "CatalogParser: JSON parse failed", std::string(sourceName)));
+        }
+        if (!st.hasAssets) {
+            return R::Err(AssetError::Make(AssetErrorCode::ParseFailed,
+                                           "CatalogParser: invalid schema (need { assets: [] } or { assets: {} })",
+                                           std::string(sourceName)));
+        }
+        if (st.badVersion) {
+            return R::Err(AssetError::Make(AssetErrorCode::ParseFailed, "CatalogParser: unsupported version", std::string(sourceName)));
         }
+        if (st.badEntry) {
+            return R::Err(AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "CatalogParser: missing id/type/path", std::string(sourceName)));
+        }
+        return R::Ok(std::move(st.entries));
+    }
 
+    Base::Result<std::vector<RawCatalogEntry>, AssetError>
+    CatalogParser::Parse(std::string_view catalogText, std::string_view sourceName) {
+        auto views = ParseViews(catalogText, sourceName);
+        if (!views) return Base::Result<std::vector<RawCatalogEntry>, AssetError>::Err(std::move(views.error()));
+
+        std::vector<RawCatalogEntry> out;
+        out.reserve(views.value().size());
+        for (const auto& v : views.value()) {
+            out.push_back(RawCatalogEntry{ std::string(v.id), std::string(v.type), std::string(v.path) });
+        }
+        unescaped_.clear();
         return Base::Result<std::vector<RawCatalogEntry>, AssetError>::Ok(std::move(out));
     }
 
@@ -0,0 +1,112 @@
+#include "engine/asset/core/AssetGraveyard.hpp"
+
+#include <algorithm>
+
+namespace Engine::Asset::Core {
+
+    AssetGraveyard::AssetGraveyard() : AssetGraveyard(Options{}) {}
+
+    AssetGraveyard::AssetGraveyard(Options opt) : opt_(opt) {
+        thread_ = std::thread([this] { ThreadMain_(); });
+    }
+
+    AssetGraveyard::~AssetGraveyard() {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            stopping_ = true;
+        }
+        workCv_.notify_all();
+        if (thread_.joinable()) thread_.join();
+    }
+
+    void AssetGraveyard::SetOptions(Options opt) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        opt_ = opt;
+    }
+
+    AssetGraveyard::Options AssetGraveyard::GetOptions() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return opt_;
+    }
+
+    void AssetGraveyard::Bury(AnyAsset asset, std::uint64_t bytes) {
+        if (asset.empty()) return;
+
+        std::vector<Body> overflow;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            pending_.push_back(Body{ std::move(asset), bytes });
+            pendingBytes_ += bytes;
+            ++counters_.buried;
+
+            // 上限を超えたら古い方から引き取り、この thread で破棄する
+            while (opt_.maxPendingBytes != 0 && pendingBytes_ > opt_.maxPendingBytes && !pending_.empty()) {
+                pendingBytes_ -= pending_.front().bytes;
+                overflow.push_back(std::move(pending_.front()));
+                pending_.pop_front();
+            }
+            counters_.destroyedInline += overflow.size();
+        }
+        workCv_.notify_one();
+
+        // デストラクタは lock の外で
+        if (overflow.empty()) return;
+        overflow.clear();
+        idleCv_.notify_all();
+    }
+
+    void AssetGraveyard::Flush() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        idleCv_.wait(lock, [this] { return pending_.empty() && destroying_ == 0; });
+    }
+
+    std::size_t AssetGraveyard::PendingCount() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return pending_.size() + destroying_;
+    }
+
+    std::uint64_t AssetGraveyard::PendingBytes() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return pendingBytes_;
+    }
+
+    AssetGraveyard::Counters AssetGraveyard::GetCounters() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return counters_;
+    }
+
+    void AssetGraveyard::ThreadMain_() {
+        std::vector<Body> batch;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mtx_);
+                workCv_.wait(lock, [this] { return stopping_ || !pending_.empty(); });
+                // 止めるときも預かった分は破棄してから抜ける
+                if (pending_.empty()) return;
+
+                const std::size_t n = std::min(pending_.size(), opt_.batchSize == 0 ? std::size_t{ 1 } : opt_.batchSize);
+                for (std::size_t i = 0; i < n; ++i) {
+                    batch.push_back(std::move(pending_.front()));
+                    pending_.pop_front();
+                }
+                destroying_ = n;
+            }
+
+            std::uint64_t bytes = 0;
+            for (const Body& b : batch) bytes += b.bytes;
+            batch.clear(); // ここで破棄
+
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+                pendingBytes_ -= bytes;
+                counters_.destroyedInBackground += destroying_;
+                destroying_ = 0;
+            }
+            idleCv_.notify_all();
+
+            // バッチの間で譲る（破棄が続いても他の thread の邪魔をしすぎない）
+            std::this_thread::yield();
+        }
+    }
+
+} // namespace Engine::Asset::Core
@@ -0,0 +1,290 @@
+#include "engine/asset/core/AssetStorage.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include "engine/asset/core/AssetGraveyard.hpp"
+
+namespace Engine::Asset::Core {
+
+    namespace {
+
+        // AssetId の値は FNV なので偏りは少ないが、shard と slot で別のビットを使うため混ぜておく
+        std::uint64_t Mix(std::uint64_t x) noexcept {
+            x ^= x >> 30;
+            x *= 0xBF58476D1CE4E5B9ull;
+            x ^= x >> 27;
+            x *= 0x94D049BB133111EBull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        // 削除済み slot の印（探索はここで止まらずに進む）
+        AssetRecord* Tombstone() noexcept {
+            static AssetRecord tomb;
+            return &tomb;
+        }
+
+        constexpr std::size_t kInitialSlots = 16;
+
+        // slot を手放すときの次の世代（0 は無効 handle なので飛ばす）
+        std::uint32_t NextGeneration(std::uint32_t g) noexcept {
+            return g + 1 == 0 ? 1 : g + 1;
+        }
+
+        // 中身を空にする（slot と世代は残す）
+        void ResetRecord(AssetRecord& r) {
+            AssetRecord fresh;
+            fresh.slot = r.slot;
+            fresh.generation = r.generation;
+            r = std::move(fresh);
+        }
+
+    } // namespace
+
+    // オープンアドレス（線形探索）の表
+    // - slot は nullptr（空）/ Tombstone（削除済み）/ record のいずれか
+    // - 読み手はロック無しで slot を acquire で読み、record の id を比べる
+    struct AssetStorage::Table {
+        std::size_t mask = 0;
+        std::size_t used = 0; // 空でない slot 数（Tombstone を含む）。書き手だけが触る
+        std::unique_ptr<std::atomic<AssetRecord*>[]> slots;
+
+        explicit Table(std::size_t capacity)
+            : mask(capacity - 1), slots(new std::atomic<AssetRecord*>[capacity]) {
+            for (std::size_t i = 0; i < capacity; ++i) slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        std::size_t Capacity() const noexcept { return mask + 1; }
+
+        AssetRecord* Lookup(std::uint64_t mixed, const AssetId& id) const noexcept {
+            for (std::size_t i = mixed & mask, n = 0; n <= mask; i = (i + 1) & mask, ++n) {
+                AssetRecord* r = slots[i].load(std::memory_order_acquire);
+                if (!r) return nullptr;
+                if (r != Tombstone() && r->id == id) return r;
+            }
+            return nullptr;
+        }
+    };
+
+    struct alignas(64) AssetStorage::Shard {
+        std::atomic<Table*> table{ nullptr };
+
+        std::mutex mutex; // 書き手（追加 / 削除 / 差し替え）と退役リスト用
+        std::unique_ptr<Table> current;
+        std::vector<std::unique_ptr<Table>> retiredTables;
+
+        // mutex 下で呼ぶ：live な record だけを詰め直した表に差し替える
+        void Rebuild(std::size_t capacity) {
+            auto next = std::make_unique<Table>(capacity);
+            if (current) {
+                for (std::size_t i = 0; i < current->Capacity(); ++i) {
+                    AssetRecord* r = current->slots[i].load(std::memory_order_relaxed);
+                    if (!r || r == Tombstone()) continue;
+                    std::size_t j = Mix(r->id.value) & next->mask;
+                    while (next->slots[j].load(std::memory_order_relaxed)) j = (j + 1) & next->mask;
+                    next->slots[j].store(r, std::memory_order_relaxed);
+                    ++next->used;
+                }
+            }
+            table.store(next.get(), std::memory_order_release);
+            if (current) retiredTables.push_back(std::move(current));
+            current = std::move(next);
+        }
+
+        // mutex 下で呼ぶ：live な record を集める
+        void CollectLive(std::vector<AssetRecord*>& out) const {
+            for (std::size_t i = 0; i < current->Capacity(); ++i) {
+                AssetRecord* r = current->slots[i].load(std::memory_order_relaxed);
+                if (r && r != Tombstone()) out.push_back(r);
+            }
+        }
+    };
+
+    AssetStorage::AssetStorage() : AssetStorage(Options{}) {}
+
+    AssetStorage::AssetStorage(Options opt)
+        : shards_(new Shard[kShardCount]) {
+        const std::uint64_t chunks = (std::uint64_t{ opt.maxRecords } + kChunkSize - 1) >> kChunkShift;
+        maxChunks_ = static_cast<std::uint32_t>(std::clamp<std::uint64_t>(chunks, 1, kMaxChunksLimit));
+        chunks_.reset(new std::atomic<Chunk*>[maxChunks_]);
+
+        for (std::size_t i = 0; i < kShardCount; ++i) shards_[i].Rebuild(kInitialSlots);
+        for (std::uint32_t i = 0; i < maxChunks_; ++i) chunks_[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    AssetStorage::~AssetStorage() {
+        for (std::uint32_t i = 0; i < maxChunks_; ++i) delete chunks_[i].load(std::memory_order_relaxed);
+    }
+
+    AssetStorage::Shard& AssetStorage::ShardOf_(std::uint64_t mixed) const noexcept {
+        // slot 位置は下位ビット、shard は上位ビット
+        static_assert(kShardCount == (std::size_t{ 1 } << 5), "ShardOf_ uses the top 5 bits");
+        return shards_[mixed >> 59];
+    }
+
+    AssetRecord& AssetStorage::SlotAt_(std::uint32_t slot) const noexcept {
+        return chunks_[slot >> kChunkShift].load(std::memory_order_relaxed)->records[slot & (kChunkSize - 1)];
+    }
+
+    AssetRecord* AssetStorage::AcquireSlot_() {
+        std::lock_guard lock(slotMutex_);
+        if (!freeSlots_.empty()) {
+            const std::uint32_t slot = freeSlots_.back();
+            freeSlots_.pop_back();
+            return &SlotAt_(slot);
+        }
+
+        const std::uint32_t slot = slotCount_.load(std::memory_order_relaxed);
+        const std::uint32_t chunk = slot >> kChunkShift;
+        if (chunk >= maxChunks_) {
+            // 上限（record のアドレスを動かさないため配列は伸ばさない）。退役 slot は ReclaimRetired で戻る
+            return nullptr;
+        }
+        if (!chunks_[chunk].load(std::memory_order_relaxed)) {
+            auto* c = new Chunk();
+            for (std::uint32_t i = 0; i < kChunkSize; ++i) c->records[i].slot = (chunk << kChunkShift) | i;
+            chunks_[chunk].store(c, std::memory_order_release);
+        }
+        slotCount_.store(slot + 1, std::memory_order_release);
+        return &SlotAt_(slot);
+    }
+
+    void AssetStorage::Clear() {
+        std::vector<AssetRecord*> live;
+        for (std::size_t i = 0; i < kShardCount; ++i) {
+            Shard& s = shards_[i];
+            std::lock_guard lock(s.mutex);
+            s.CollectLive(live);
+            s.current.reset();
+            s.Rebuild(kInitialSlots);
+            s.retiredTables.clear();
+        }
+
+        std::lock_guard lock(slotMutex_);
+        for (AssetRecord* r : live) r->generation = NextGeneration(r->generation);
+
+        // 小さい slot から再利用されるよう降順に積む
+        const std::uint32_t count = slotCount_.load(std::memory_order_relaxed);
+        freeSlots_.clear();
+        retiredSlots_.clear();
+        for (std::uint32_t slot = count; slot-- > 0;) {
+            ResetRecord(SlotAt_(slot));
+            freeSlots_.push_back(slot);
+        }
+        size_.store(0, std::memory_order_relaxed);
+    }
+
+    AssetRecord* AssetStorage::Find(const AssetId& id) noexcept {
+        const std::uint64_t mixed = Mix(id.value);
+        return ShardOf_(mixed).table.load(std::memory_order_acquire)->Lookup(mixed, id);
+    }
+
+    const AssetRecord* AssetStorage::Find(const AssetId& id) const noexcept {
+        const std::uint64_t mixed = Mix(id.value);
+        return ShardOf_(mixed).table.load(std::memory_order_acquire)->Lookup(mixed, id);
+    }
+
+    AssetRecord* AssetStorage::GetOrCreate(const AssetId& id, const AssetType& type, std::string resolvedPath) {
+        const std::uint64_t mixed = Mix(id.value);
+        Shard& s = ShardOf_(mixed);
+        if (auto* r = s.table.load(std::memory_order_acquire)->Lookup(mixed, id)) return r;
+
+        std::lock_guard lock(s.mutex);
+        // ロックを取る間に他スレッドが作ったかもしれない
+        if (auto* r = s.current->Lookup(mixed, id)) return r;
+
+        // 空き slot に作る（世代は前の持ち主より大きい値を引き継ぐ）
+        AssetRecord* slot = AcquireSlot_();
+        if (!slot) return nullptr;
+        AssetRecord& rec = *slot;
+        rec.id = id;
+        rec.type = type;
+        rec.resolvedPath = std::move(resolvedPath);
+        rec.state = AssetState::Unloaded;
+        rec.refCount = 0;
+        rec.residentBytes = 0;
+        rec.sourceBytes = 0;
+
+        // 負荷率 1/2 を超えるなら作り直す（Tombstone が多いだけなら同じ大きさで掃除）
+        if ((s.current->used + 1) * 2 > s.current->Capacity()) {
+            std::size_t cap = s.current->Capacity();
+            std::size_t live = 0;
+            for (std::size_t i = 0; i < cap; ++i) {
+                AssetRecord* r = s.current->slots[i].load(std::memory_order_relaxed);
+                if (r && r != Tombstone()) ++live;
+            }
+            while ((live + 1) * 2 > cap) cap *= 2;
+            s.Rebuild(cap);
+        }
+
+        // 空き or Tombstone の最初の slot に置く（release：読み手は record の中身ごと見える）
+        Table& t = *s.current;
+        std::size_t i = mixed & t.mask;
+        for (;; i = (i + 1) & t.mask) {
+            AssetRecord* cur = t.slots[i].load(std::memory_order_relaxed);
+            if (!cur || cur == Tombstone()) {
+                if (!cur) ++t.used;
+                break;
+            }
+        }
+        t.slots[i].store(&rec, std::memory_order_release);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return &rec;
+    }
+
+    void AssetStorage::EraseIf(const AssetId& id, bool force) {
+        const std::uint64_t mixed = Mix(id.value);
+        Shard& s = ShardOf_(mixed);
+
+        std::lock_guard lock(s.mutex);
+        Table& t = *s.current;
+        for (std::size_t i = mixed & t.mask, n = 0; n <= t.mask; i = (i + 1) & t.mask, ++n) {
+            AssetRecord* r = t.slots[i].load(std::memory_order_relaxed);
+            if (!r) return;
+            if (r == Tombstone() || r->id != id) continue;
+
+            if (!force && std::atomic_ref<std::uint32_t>(r->refCount).load(std::memory_order_relaxed) != 0) return;
+
+            t.slots[i].store(Tombstone(), std::memory_order_release);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+
+            // 世代を進めて古い handle を即 stale にする（中身は同期点まで残す）
+            std::atomic_ref<std::uint32_t>(r->generation).store(NextGeneration(r->generation), std::memory_order_release);
+            std::lock_guard slotLock(slotMutex_);
+            retiredSlots_.push_back(r->slot);
+            return;
+        }
+    }
+
+    std::size_t AssetStorage::ReclaimRetired(AssetGraveyard* graveyard) {
+        for (std::size_t i = 0; i < kShardCount; ++i) {
+            Shard& s = shards_[i];
+            std::lock_guard lock(s.mutex);
+            s.retiredTables.clear();
+        }
+
+        std::vector<std::uint32_t> retired;
+        {
+            std::lock_guard lock(slotMutex_);
+            retired.swap(retiredSlots_);
+        }
+        // asset の解放（デストラクタ）はロックの外で。graveyard があればそちらへ預ける
+        for (std::uint32_t slot : retired) {
+            AssetRecord& r = SlotAt_(slot);
+            if (graveyard && !r.asset.empty()) graveyard->Bury(std::move(r.asset), r.residentBytes);
+            ResetRecord(r);
+        }
+
+        std::lock_guard lock(slotMutex_);
+        freeSlots_.insert(freeSlots_.end(), retired.rbegin(), retired.rend());
+        return retired.size();
+    }
+
+    std::size_t AssetStorage::RetiredCount() const {
+        std::lock_guard lock(slotMutex_);
+        return retiredSlots_.size();
+    }
+
+} // namespace Engine::Asset::Core
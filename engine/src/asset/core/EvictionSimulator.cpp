@@ -0,0 +1,78 @@
+#include "engine/asset/core/EvictionSimulator.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Engine::Asset::Core {
+
+    EvictionSimulator::Result
+    EvictionSimulator::Run(IEvictionStrategy& strategy, Detail::ConstSpan<EvictionTraceEvent> trace) const {
+        strategy.Clear();
+
+        Result r{};
+        std::unordered_map<AssetId, std::uint64_t> resident; // id -> 常駐バイト
+        std::unordered_set<AssetId> seen;
+        std::uint64_t residentBytes = 0;
+
+        auto over = [&] {
+            if (opt_.capacityCount != 0 && resident.size() > opt_.capacityCount) return true;
+            return opt_.capacityBytes != 0 && residentBytes > opt_.capacityBytes;
+        };
+
+        for (const EvictionTraceEvent& ev : trace) {
+            ++r.accesses;
+            if (resident.find(ev.id) != resident.end()) {
+                ++r.hits;
+                strategy.OnAccess(ev.id);
+                continue;
+            }
+
+            const std::uint64_t cost = ev.reloadCost != 0 ? ev.reloadCost : ev.bytes;
+            ++r.misses;
+            r.missBytes += cost;
+            if (!seen.insert(ev.id).second) r.reloadBytes += cost;
+
+            resident.emplace(ev.id, ev.bytes);
+            residentBytes += ev.bytes;
+            strategy.OnInsert(ev.id, ev.bytes, cost);
+
+            // 容量に収まるまで、strategy の順で消す（今読んだものは参照中なので飛ばす）
+            while (over()) {
+                AssetId victim{};
+                bool found = false;
+                strategy.ForEachVictim([&](const AssetId& id) {
+                    if (id == ev.id) return true;
+                    victim = id;
+                    found = true;
+                    return false;
+                });
+                if (!found) break;
+
+                auto it = resident.find(victim);
+                residentBytes -= it->second;
+                resident.erase(it);
+                strategy.OnRemove(victim);
+                ++r.evictions;
+            }
+            r.peakResidentBytes = std::max(r.peakResidentBytes, residentBytes);
+        }
+        return r;
+    }
+
+    std::vector<std::pair<EvictionAlgorithm, EvictionSimulator::Result>>
+    EvictionSimulator::Compare(Detail::ConstSpan<EvictionTraceEvent> trace) const {
+        std::vector<std::pair<EvictionAlgorithm, Result>> out;
+        for (EvictionAlgorithm a : { EvictionAlgorithm::Lru, EvictionAlgorithm::Lfu,
+                                     EvictionAlgorithm::Arc, EvictionAlgorithm::Gdsf }) {
+            auto strategy = MakeEvictionStrategy(a, opt_.capacityCount);
+            out.emplace_back(a, Run(*strategy, trace));
+        }
+        std::stable_sort(out.begin(), out.end(), [](const auto& x, const auto& y) {
+            if (x.second.reloadBytes != y.second.reloadBytes) return x.second.reloadBytes < y.second.reloadBytes;
+            return x.second.hits > y.second.hits;
+        });
+        return out;
+    }
+
+} // namespace Engine::Asset::Core
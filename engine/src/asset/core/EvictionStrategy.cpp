@@ -0,0 +1,320 @@
+#include "engine/asset/core/EvictionStrategy.hpp"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+namespace Engine::Asset::Core {
+
+    namespace {
+
+        // LRU：使われた順（先頭がいちばん古い）
+        class LruStrategy final : public IEvictionStrategy {
+        public:
+            EvictionAlgorithm Algorithm() const noexcept override { return EvictionAlgorithm::Lru; }
+
+            void OnInsert(const AssetId& id, std::uint64_t, std::uint64_t) override {
+                if (Contains(id)) {
+                    OnAccess(id);
+                    return;
+                }
+                order_.push_back(id);
+                index_.emplace(id, std::prev(order_.end()));
+            }
+
+            void OnAccess(const AssetId& id) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) return;
+                order_.splice(order_.end(), order_, it->second);
+            }
+
+            void OnRemove(const AssetId& id) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) return;
+                order_.erase(it->second);
+                index_.erase(it);
+            }
+
+            bool Contains(const AssetId& id) const noexcept override { return index_.find(id) != index_.end(); }
+            std::size_t Size() const noexcept override { return index_.size(); }
+
+            void Clear() override {
+                order_.clear();
+                index_.clear();
+            }
+
+            void ForEachVictim(const std::function<bool(const AssetId&)>& fn) const override {
+                for (const AssetId& id : order_) {
+                    if (!fn(id)) return;
+                }
+            }
+
+        private:
+            std::list<AssetId> order_;
+            std::unordered_map<AssetId, std::list<AssetId>::iterator> index_;
+        };
+
+        // LFU：ヒット回数の少ない順。同数なら最後に使われたのが古い順
+        // - 回数は AssetStatistics::PerAsset::hits と同じ所（cache hit / Acquire）で数える
+        //   statistics が無くても動くよう、strategy 側で持つ
+        class LfuStrategy final : public IEvictionStrategy {
+        public:
+            EvictionAlgorithm Algorithm() const noexcept override { return EvictionAlgorithm::Lfu; }
+
+            void OnInsert(const AssetId& id, std::uint64_t, std::uint64_t) override {
+                if (Contains(id)) {
+                    OnAccess(id);
+                    return;
+                }
+                const Key key{ 1, ++tick_ };
+                order_.emplace(key, id);
+                index_.emplace(id, key);
+            }
+
+            void OnAccess(const AssetId& id) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) return;
+                order_.erase(it->second);
+                it->second = Key{ it->second.first + 1, ++tick_ };
+                order_.emplace(it->second, id);
+            }
+
+            void OnRemove(const AssetId& id) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) return;
+                order_.erase(it->second);
+                index_.erase(it);
+            }
+
+            bool Contains(const AssetId& id) const noexcept override { return index_.find(id) != index_.end(); }
+            std::size_t Size() const noexcept override { return index_.size(); }
+
+            void Clear() override {
+                order_.clear();
+                index_.clear();
+                tick_ = 0;
+            }
+
+            void ForEachVictim(const std::function<bool(const AssetId&)>& fn) const override {
+                for (const auto& [key, id] : order_) {
+                    if (!fn(id)) return;
+                }
+            }
+
+        private:
+            using Key = std::pair<std::uint64_t, std::uint64_t>; // (回数, 最後に使われた tick)
+
+            std::map<Key, AssetId> order_;
+            std::unordered_map<AssetId, Key> index_;
+            std::uint64_t tick_ = 0;
+        };
+
+        // GDSF：H = L + 回数 * 読み直しコスト / 常駐サイズ の小さい順
+        // - 大きいのに安く読み直せるもの（展開後が大きいテクスチャなど）から消える
+        // - 消すたびに L を消した entry の H まで上げる（aging：昔よく使われただけの entry も、いずれ消える）
+        class GdsfStrategy final : public IEvictionStrategy {
+        public:
+            EvictionAlgorithm Algorithm() const noexcept override { return EvictionAlgorithm::Gdsf; }
+
+            void OnInsert(const AssetId& id, std::uint64_t bytes, std::uint64_t reloadCost) override {
+                const double size = static_cast<double>(bytes != 0 ? bytes : 1);
+                const double cost = static_cast<double>(reloadCost != 0 ? reloadCost : (bytes != 0 ? bytes : 1));
+
+                auto it = index_.find(id);
+                if (it == index_.end()) {
+                    it = index_.emplace(id, Entry{}).first;
+                } else {
+                    order_.erase(it->second.key);
+                }
+                Entry& e = it->second;
+                e.costPerByte = cost / size;
+                ++e.freq;
+                Place_(id, e);
+            }
+
+            void OnAccess(const AssetId& id) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) return;
+                order_.erase(it->second.key);
+                ++it->second.freq;
+                Place_(id, it->second);
+            }
+
+            void OnRemove(const AssetId& id) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) return;
+                inflation_ = std::max(inflation_, it->second.key.first);
+                order_.erase(it->second.key);
+                index_.erase(it);
+            }
+
+            bool Contains(const AssetId& id) const noexcept override { return index_.find(id) != index_.end(); }
+            std::size_t Size() const noexcept override { return index_.size(); }
+
+            void Clear() override {
+                order_.clear();
+                index_.clear();
+                inflation_ = 0.0;
+                tick_ = 0;
+            }
+
+            void ForEachVictim(const std::function<bool(const AssetId&)>& fn) const override {
+                for (const auto& [key, id] : order_) {
+                    if (!fn(id)) return;
+                }
+            }
+
+        private:
+            using Key = std::pair<double, std::uint64_t>; // (H, tick)：同じ H なら古い順
+
+            struct Entry final {
+                std::uint64_t freq = 0;
+                double costPerByte = 1.0;
+                Key key{};
+            };
+
+            void Place_(const AssetId& id, Entry& e) {
+                e.key = Key{ inflation_ + static_cast<double>(e.freq) * e.costPerByte, ++tick_ };
+                order_.emplace(e.key, id);
+            }
+
+            std::map<Key, AssetId> order_;
+            std::unordered_map<AssetId, Entry> index_;
+            double inflation_ = 0.0; // L
+            std::uint64_t tick_ = 0;
+        };
+
+        // ARC（Megiddo & Modha）
+        // - T1：1 回だけ使われた常駐、T2：2 回以上使われた常駐、B1 / B2：T1 / T2 から消えた id の ghost
+        // - B1 の id がまた読まれたら recency 側（T1 の目標 p）を広げ、B2 なら frequency 側を広げる
+        // - 容量の管理（いつ消すか）は呼び出し側。ここは T1 / T2 のどちらから消すかを p で決めて順番を返す
+        class ArcStrategy final : public IEvictionStrategy {
+        public:
+            explicit ArcStrategy(std::size_t capacity) : capacity_(capacity) {}
+
+            EvictionAlgorithm Algorithm() const noexcept override { return EvictionAlgorithm::Arc; }
+
+            void OnInsert(const AssetId& id, std::uint64_t, std::uint64_t) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) {
+                    lists_[T1].push_back(id);
+                    index_.emplace(id, Node{ T1, std::prev(lists_[T1].end()) });
+                    TrimGhosts_();
+                    return;
+                }
+
+                Node& n = it->second;
+                const double b1 = static_cast<double>(lists_[B1].size());
+                const double b2 = static_cast<double>(lists_[B2].size());
+                const double c = static_cast<double>(Capacity_());
+                switch (n.list) {
+                case T1:
+                case T2:
+                    MoveTo_(n, T2);
+                    return;
+                case B1:
+                    p_ = std::min(c, p_ + std::max(1.0, b2 / b1));
+                    break;
+                case B2:
+                    p_ = std::max(0.0, p_ - std::max(1.0, b1 / b2));
+                    break;
+                }
+                MoveTo_(n, T2);
+                TrimGhosts_();
+            }
+
+            void OnAccess(const AssetId& id) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) return;
+                if (it->second.list == T1 || it->second.list == T2) MoveTo_(it->second, T2);
+            }
+
+            void OnRemove(const AssetId& id) override {
+                auto it = index_.find(id);
+                if (it == index_.end()) return;
+                Node& n = it->second;
+                if (n.list == T1) MoveTo_(n, B1);
+                else if (n.list == T2) MoveTo_(n, B2);
+                TrimGhosts_();
+            }
+
+            bool Contains(const AssetId& id) const noexcept override {
+                auto it = index_.find(id);
+                return it != index_.end() && (it->second.list == T1 || it->second.list == T2);
+            }
+
+            std::size_t Size() const noexcept override { return lists_[T1].size() + lists_[T2].size(); }
+
+            void Clear() override {
+                for (auto& l : lists_) l.clear();
+                index_.clear();
+                p_ = 0.0;
+            }
+
+            void ForEachVictim(const std::function<bool(const AssetId&)>& fn) const override {
+                // REPLACE：T1 が目標 p を超えていれば T1 の古い方から、そうでなければ T2 から
+                const bool t1First = !lists_[T1].empty() && static_cast<double>(lists_[T1].size()) > p_;
+                const ListId first = t1First ? T1 : T2;
+                const ListId second = t1First ? T2 : T1;
+                for (ListId l : { first, second }) {
+                    for (const AssetId& id : lists_[l]) {
+                        if (!fn(id)) return;
+                    }
+                }
+            }
+
+        private:
+            enum ListId : std::uint8_t { T1 = 0, T2, B1, B2 };
+
+            struct Node final {
+                ListId list = T1;
+                std::list<AssetId>::iterator it{};
+            };
+
+            std::size_t Capacity_() const noexcept {
+                if (capacity_ != 0) return capacity_;
+                return std::max<std::size_t>(1, Size());
+            }
+
+            void MoveTo_(Node& n, ListId to) {
+                lists_[to].splice(lists_[to].end(), lists_[n.list], n.it);
+                n.list = to;
+            }
+
+            void DropGhost_(ListId l) {
+                index_.erase(lists_[l].front());
+                lists_[l].pop_front();
+            }
+
+            // ghost は |T1|+|B1| <= c、全体で 2c まで
+            void TrimGhosts_() {
+                const std::size_t c = Capacity_();
+                while (!lists_[B1].empty() && lists_[T1].size() + lists_[B1].size() > c) DropGhost_(B1);
+                while (!lists_[B2].empty() && index_.size() > 2 * c) DropGhost_(B2);
+            }
+
+            std::size_t capacity_ = 0;
+            std::list<AssetId> lists_[4];
+            std::unordered_map<AssetId, Node> index_;
+            double p_ = 0.0; // T1 の目標サイズ
+        };
+
+    } // namespace
+
+    std::unique_ptr<IEvictionStrategy> MakeEvictionStrategy(EvictionAlgorithm algorithm, std::size_t arcCapacity) {
+        switch (algorithm) {
+        case EvictionAlgorithm::Lfu:
+            return std::make_unique<LfuStrategy>();
+        case EvictionAlgorithm::Arc:
+            return std::make_unique<ArcStrategy>(arcCapacity);
+        case EvictionAlgorithm::Gdsf:
+            return std::make_unique<GdsfStrategy>();
+        case EvictionAlgorithm::Lru:
+        default:
+            return std::make_unique<LruStrategy>();
+        }
+    }
+
+} // namespace Engine::Asset::Core
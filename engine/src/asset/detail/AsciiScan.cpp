@@ -0,0 +1,186 @@
+#include "engine/asset/detail/AsciiScan.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ENGINE_ASSET_HAS_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace Engine::Asset::Detail {
+
+    namespace {
+
+        constexpr std::size_t kBlock = 64;
+
+        inline bool IsDigit(unsigned char c) noexcept { return static_cast<unsigned char>(c - '0') < 10; }
+
+        // std::isspace（"C" ロケール）と同じ：' ' と \t \n \v \f \r
+        inline bool IsSpace(unsigned char c) noexcept { return c == ' ' || static_cast<unsigned char>(c - '\t') < 5; }
+
+        inline unsigned CountTrailingZeros(std::uint64_t v) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long idx = 0;
+            _BitScanForward64(&idx, v);
+            return static_cast<unsigned>(idx);
+#else
+            return static_cast<unsigned>(__builtin_ctzll(v));
+#endif
+        }
+
+        // 64 バイトの数字/空白マスク（bit i = p[i]）
+        inline void ClassifyBlock(const char* p, std::uint64_t& digits, std::uint64_t& spaces) noexcept {
+#if defined(ENGINE_ASSET_HAS_SSE2)
+            const __m128i zero = _mm_set1_epi8('0');
+            const __m128i nine = _mm_set1_epi8(9);
+            const __m128i tab = _mm_set1_epi8('\t');
+            const __m128i four = _mm_set1_epi8(4);
+            const __m128i space = _mm_set1_epi8(' ');
+
+            digits = 0;
+            spaces = 0;
+            for (int k = 0; k < 4; ++k) {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + k * 16));
+
+                // 符号なし比較：(x - '0') <= 9  <=>  min(x - '0', 9) == x - '0'
+                const __m128i d = _mm_sub_epi8(x, zero);
+                const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(d, nine), d);
+
+                const __m128i t = _mm_sub_epi8(x, tab);
+                const __m128i isCtrlSpace = _mm_cmpeq_epi8(_mm_min_epu8(t, four), t);
+                const __m128i isSpace = _mm_or_si128(isCtrlSpace, _mm_cmpeq_epi8(x, space));
+
+                digits |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(isDigit))) << (k * 16);
+                spaces |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(isSpace))) << (k * 16);
+            }
+#else
+            digits = 0;
+            spaces = 0;
+            for (std::size_t i = 0; i < kBlock; ++i) {
+                const auto c = static_cast<unsigned char>(p[i]);
+                digits |= static_cast<std::uint64_t>(IsDigit(c)) << i;
+                spaces |= static_cast<std::uint64_t>(IsSpace(c)) << i;
+            }
+#endif
+        }
+
+        // 出力：3 値ごとに alpha を挟む
+        struct RgbaWriter final {
+            std::uint8_t* dst;
+            std::size_t remaining; // 残りの値の数
+            unsigned channel = 0;
+
+            void Put(std::uint8_t v) noexcept {
+                *dst++ = v;
+                if (++channel == 3) {
+                    *dst++ = 255;
+                    channel = 0;
+                }
+                --remaining;
+            }
+        };
+
+        // 1..3 桁を分岐なしで組み立てる（桁数外の重みは 0 なので、その位置の文字は何でもよい）
+        inline std::uint32_t Combine3(const char* p, unsigned len) noexcept {
+            static constexpr std::uint8_t kWeights[4][3] = {
+                { 0, 0, 0 }, { 1, 0, 0 }, { 10, 1, 0 }, { 100, 10, 1 },
+            };
+            const auto* w = kWeights[len];
+            const auto a = static_cast<std::uint32_t>(static_cast<unsigned char>(p[0]) - '0') & 0xFFu;
+            const auto b = static_cast<std::uint32_t>(static_cast<unsigned char>(p[1]) - '0') & 0xFFu;
+            const auto c = static_cast<std::uint32_t>(static_cast<unsigned char>(p[2]) - '0') & 0xFFu;
+            return a * w[0] + b * w[1] + c * w[2];
+        }
+
+        // 1 つの数字列を逐次で読む（ブロック境界をまたぐもの / 4 桁以上（先頭 0 付き）/ 末尾）
+        inline bool ParseRun(const char*& p, const char* end, std::uint32_t& out) noexcept {
+            std::uint32_t v = 0;
+            const char* q = p;
+            while (q < end && IsDigit(static_cast<unsigned char>(*q))) {
+                v = v * 10 + static_cast<std::uint32_t>(*q - '0');
+                if (v > 255) return false;
+                ++q;
+            }
+            if (q == p) return false;
+            out = v;
+            p = q;
+            return true;
+        }
+
+    } // namespace
+
+    bool ParseAsciiRgbToRgba(const char*& p, const char* end, std::uint8_t* rgba, std::size_t pixels) noexcept {
+        RgbaWriter out{ rgba, pixels * 3 };
+        const char* pos = p;
+
+        while (out.remaining > 0) {
+            // ---- 64 バイト単位 ----
+            if (static_cast<std::size_t>(end - pos) >= kBlock) {
+                std::uint64_t digits = 0, spaces = 0;
+                ClassifyBlock(pos, digits, spaces);
+                if ((digits | spaces) != ~std::uint64_t{ 0 }) return false; // 数字/空白以外がある
+
+                // 数字列の先頭（直前が数字でない数字）。pos は常に数字列の途中ではない
+                std::uint64_t starts = digits & ~(digits << 1);
+                bool crossed = false;
+
+                while (starts != 0) {
+                    const unsigned i = CountTrailingZeros(starts);
+                    const std::uint64_t rest = ~(digits >> i);
+                    if (rest == 0) {
+                        // ブロック末尾まで数字：次ブロックへ続くかもしれない
+                        pos += i;
+                        crossed = true;
+                        break;
+                    }
+                    const unsigned len = CountTrailingZeros(rest);
+                    if (i + len >= kBlock) {
+                        pos += i;
+                        crossed = true;
+                        break;
+                    }
+
+                    std::uint32_t v = 0;
+                    if (len <= 3 && i + 3 <= kBlock) { // 3 バイト読んでもブロック内
+                        v = Combine3(pos + i, len);
+                        if (v > 255) return false;
+                    } else {
+                        const char* q = pos + i;
+                        if (!ParseRun(q, end, v)) return false;
+                    }
+
+                    out.Put(static_cast<std::uint8_t>(v));
+                    if (out.remaining == 0) {
+                        p = pos + i + len;
+                        return true;
+                    }
+                    starts &= starts - 1;
+                }
+
+                if (!crossed) {
+                    pos += kBlock;
+                    continue;
+                }
+
+                std::uint32_t v = 0;
+                if (!ParseRun(pos, end, v)) return false;
+                out.Put(static_cast<std::uint8_t>(v));
+                continue;
+            }
+
+            // ---- 末尾（64 バイト未満） ----
+            while (pos < end && IsSpace(static_cast<unsigned char>(*pos))) ++pos;
+            if (pos >= end) return false;
+
+            std::uint32_t v = 0;
+            if (!ParseRun(pos, end, v)) return false;
+            out.Put(static_cast<std::uint8_t>(v));
+        }
+
+        p = pos;
+        return true;
+    }
+
+} // namespace Engine::Asset::Detail
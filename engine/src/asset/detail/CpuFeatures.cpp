@@ -0,0 +1,50 @@
+#include "engine/asset/detail/CpuFeatures.hpp"
+
+#if defined(ENGINE_ASSET_X86) && defined(_MSC_VER) && !defined(__clang__)
+    #include <immintrin.h>
+    #include <intrin.h>
+#endif
+
+namespace Engine::Asset::Detail {
+
+#if defined(ENGINE_ASSET_X86)
+    namespace {
+        SimdLevel DetectSimdLevelUncached() noexcept {
+    #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4] = {};
+            __cpuid(info, 0);
+            const int maxLeaf = info[0];
+
+            __cpuid(info, 1);
+            const bool ssse3 = (info[2] & (1 << 9)) != 0;
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+
+            bool avx2 = false;
+            if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+                __cpuidex(info, 7, 0);
+                avx2 = (info[1] & (1 << 5)) != 0;
+            }
+            if (avx2) return SimdLevel::Avx2;
+            if (ssse3) return SimdLevel::Ssse3;
+            return SimdLevel::Scalar;
+    #else
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+            if (__builtin_cpu_supports("ssse3")) return SimdLevel::Ssse3;
+            return SimdLevel::Scalar;
+    #endif
+        }
+    }
+#endif
+
+    SimdLevel DetectSimdLevel() noexcept {
+#if defined(ENGINE_ASSET_X86)
+        static const SimdLevel level = DetectSimdLevelUncached();
+        return level;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+} // namespace Engine::Asset::Detail
@@ -0,0 +1,129 @@
+#include "engine/asset/detail/FileMapping.hpp"
+
+#include <string>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define ENGINE_ASSET_HAS_MMAP 1
+#else
+    #include <fstream>
+#endif
+
+namespace Engine::Asset::Detail {
+
+    using AssetError = FileMapping::AssetError;
+    using OpenResult = Base::Result<std::shared_ptr<const FileMapping>, AssetError>;
+
+    FileMapping::~FileMapping() {
+#if defined(_WIN32)
+        if (mapped_ && data_) UnmapViewOfFile(data_);
+        if (mapHandle_) CloseHandle(static_cast<HANDLE>(mapHandle_));
+        if (fileHandle_) CloseHandle(static_cast<HANDLE>(fileHandle_));
+#elif defined(ENGINE_ASSET_HAS_MMAP)
+        if (mapped_ && data_) {
+            munmap(const_cast<std::byte*>(data_), size_);
+        }
+#endif
+    }
+
+    OpenResult FileMapping::Open(std::string_view path) {
+        const std::string p(path);
+        std::shared_ptr<FileMapping> m(new FileMapping());
+
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(p.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            const DWORD err = GetLastError();
+            const auto code = (err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND)
+                            ? AssetErrorCode::SourceNotFound : AssetErrorCode::SourceReadFailed;
+            return OpenResult::Err(AssetError::Make(code, "FileMapping: cannot open file", p));
+        }
+        m->fileHandle_ = file;
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size)) {
+            return OpenResult::Err(AssetError::Make(AssetErrorCode::SourceReadFailed, "FileMapping: cannot get file size", p));
+        }
+        m->size_ = static_cast<std::size_t>(size.QuadPart);
+        if (m->size_ == 0) return OpenResult::Ok(std::move(m)); // 空ファイルは map できない
+
+        HANDLE map = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!map) {
+            return OpenResult::Err(AssetError::Make(AssetErrorCode::SourceReadFailed, "FileMapping: CreateFileMapping failed", p));
+        }
+        m->mapHandle_ = map;
+
+        void* view = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            return OpenResult::Err(AssetError::Make(AssetErrorCode::SourceReadFailed, "FileMapping: MapViewOfFile failed", p));
+        }
+        m->data_ = static_cast<const std::byte*>(view);
+        m->mapped_ = true;
+        return OpenResult::Ok(std::move(m));
+
+#elif defined(ENGINE_ASSET_HAS_MMAP)
+        const int fd = ::open(p.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            const auto code = (errno == ENOENT || errno == ENOTDIR)
+                            ? AssetErrorCode::SourceNotFound : AssetErrorCode::SourceReadFailed;
+            return OpenResult::Err(AssetError::Make(code, "FileMapping: cannot open file", p));
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return OpenResult::Err(AssetError::Make(AssetErrorCode::SourceReadFailed, "FileMapping: not a regular file", p));
+        }
+        m->size_ = static_cast<std::size_t>(st.st_size);
+        if (m->size_ == 0) {
+            ::close(fd);
+            return OpenResult::Ok(std::move(m)); // 空ファイルは map できない
+        }
+
+        void* addr = ::mmap(nullptr, m->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // mapping は fd を閉じても有効
+        if (addr == MAP_FAILED) {
+            return OpenResult::Err(AssetError::Make(AssetErrorCode::SourceReadFailed, "FileMapping: mmap failed", p));
+        }
+        // loader は基本先頭から舐めるので先読みを促す（失敗しても無視）
+        (void)::madvise(addr, m->size_, MADV_SEQUENTIAL);
+
+        m->data_ = static_cast<const std::byte*>(addr);
+        m->mapped_ = true;
+        return OpenResult::Ok(std::move(m));
+
+#else
+        std::ifstream ifs(p, std::ios::in | std::ios::binary);
+        if (!ifs) {
+            return OpenResult::Err(AssetError::Make(AssetErrorCode::SourceNotFound, "FileMapping: cannot open file", p));
+        }
+        ifs.seekg(0, std::ios::end);
+        const auto end = ifs.tellg();
+        ifs.seekg(0, std::ios::beg);
+        if (end < 0) {
+            return OpenResult::Err(AssetError::Make(AssetErrorCode::SourceReadFailed, "FileMapping: cannot get file size", p));
+        }
+        m->size_ = static_cast<std::size_t>(end);
+        m->fallback_ = std::make_unique<std::byte[]>(m->size_);
+        if (m->size_ != 0 && !ifs.read(reinterpret_cast<char*>(m->fallback_.get()), static_cast<std::streamsize>(m->size_))) {
+            return OpenResult::Err(AssetError::Make(AssetErrorCode::SourceReadFailed, "FileMapping: read failed", p));
+        }
+        m->data_ = m->fallback_.get();
+        return OpenResult::Ok(std::move(m));
+#endif
+    }
+
+} // namespace Engine::Asset::Detail
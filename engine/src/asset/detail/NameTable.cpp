@@ -0,0 +1,41 @@
+#include "engine/asset/detail/NameTable.hpp"
+
+#include <mutex>
+
+namespace Engine::Asset::Detail {
+
+    NameTable::InternResult NameTable::Intern(std::uint64_t key, std::string_view name) {
+        {
+            std::shared_lock lock(mutex_);
+            auto it = names_.find(key);
+            if (it != names_.end()) return it->second == name ? InternResult::Existing : InternResult::Collision;
+        }
+
+        std::unique_lock lock(mutex_);
+        auto [it, added] = names_.try_emplace(key, name);
+        if (added) return InternResult::Added;
+        return it->second == name ? InternResult::Existing : InternResult::Collision;
+    }
+
+    std::string_view NameTable::Find(std::uint64_t key) const {
+        std::shared_lock lock(mutex_);
+        auto it = names_.find(key);
+        return it == names_.end() ? std::string_view{} : std::string_view{ it->second };
+    }
+
+    std::size_t NameTable::Size() const {
+        std::shared_lock lock(mutex_);
+        return names_.size();
+    }
+
+    NameTable& AssetIdNames() {
+        static NameTable table;
+        return table;
+    }
+
+    NameTable& AssetTypeNames() {
+        static NameTable table;
+        return table;
+    }
+
+} // namespace Engine::Asset::Detail
@@ -0,0 +1,23 @@
+#include "engine/asset/detail/PcmConvert.hpp"
+
+#include <bit>
+#include <cstring>
+
+namespace Engine::Asset::Detail {
+
+    void ByteSwap16(const std::uint8_t* src, std::int16_t* dst, std::size_t samples) noexcept {
+        for (std::size_t i = 0; i < samples; ++i) {
+            const auto u = static_cast<std::uint16_t>((src[i * 2] << 8) | src[i * 2 + 1]);
+            dst[i] = static_cast<std::int16_t>(u);
+        }
+    }
+
+    void Pcm16LeToNative(const std::uint8_t* src, std::int16_t* dst, std::size_t samples) noexcept {
+        if constexpr (std::endian::native == std::endian::little) {
+            if (samples > 0) std::memcpy(dst, src, samples * sizeof(std::int16_t));
+        } else {
+            ByteSwap16(src, dst, samples);
+        }
+    }
+
+} // namespace Engine::Asset::Detail
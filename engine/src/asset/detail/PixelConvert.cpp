@@ -0,0 +1,104 @@
+#include "engine/asset/detail/PixelConvert.hpp"
+
+#if defined(ENGINE_ASSET_X86)
+    #include <immintrin.h>
+#endif
+
+namespace Engine::Asset::Detail {
+
+    namespace {
+
+        void Rgb24ToRgba32Scalar(const std::uint8_t* src, std::uint8_t* dst, std::size_t pixels) noexcept {
+            for (std::size_t i = 0; i < pixels; ++i) {
+                dst[0] = src[0];
+                dst[1] = src[1];
+                dst[2] = src[2];
+                dst[3] = 255;
+                src += 3;
+                dst += 4;
+            }
+        }
+
+#if defined(ENGINE_ASSET_X86)
+        // 1 レーン（16B）内で RGB x4 -> RGBA x4。alpha の位置は 0 にしておき後で OR する
+        #define ENGINE_ASSET_RGB_TO_RGBA_MASK \
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+
+        ENGINE_ASSET_TARGET("ssse3")
+        void Rgb24ToRgba32Ssse3(const std::uint8_t* src, std::uint8_t* dst, std::size_t pixels) noexcept {
+            const __m128i mask = _mm_setr_epi8(ENGINE_ASSET_RGB_TO_RGBA_MASK);
+            const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+            // 16 画素（48B -> 64B）ずつ
+            std::size_t i = 0;
+            for (; i + 16 <= pixels; i += 16) {
+                const __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+                const __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+                const __m128i in2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+
+                const __m128i p0 = in0;                          // bytes  0..11
+                const __m128i p1 = _mm_alignr_epi8(in1, in0, 12); // bytes 12..23
+                const __m128i p2 = _mm_alignr_epi8(in2, in1, 8);  // bytes 24..35
+                const __m128i p3 = _mm_srli_si128(in2, 4);        // bytes 36..47
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst +  0), _mm_or_si128(_mm_shuffle_epi8(p0, mask), alpha));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_or_si128(_mm_shuffle_epi8(p1, mask), alpha));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 32), _mm_or_si128(_mm_shuffle_epi8(p2, mask), alpha));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 48), _mm_or_si128(_mm_shuffle_epi8(p3, mask), alpha));
+
+                src += 48;
+                dst += 64;
+            }
+            Rgb24ToRgba32Scalar(src, dst, pixels - i);
+        }
+
+        ENGINE_ASSET_TARGET("avx2")
+        void Rgb24ToRgba32Avx2(const std::uint8_t* src, std::uint8_t* dst, std::size_t pixels) noexcept {
+            const __m256i mask = _mm256_setr_epi8(ENGINE_ASSET_RGB_TO_RGBA_MASK, ENGINE_ASSET_RGB_TO_RGBA_MASK);
+            const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+
+            // 8 画素（24B）を 12B ずつ 2 レーンに載せる：レーン読みは 16B なので末尾 4B はみ出す
+            // -> 残り 8 画素 + 4B 以上ある間だけ回す（16 画素ずつ：最後の読みは src+36..src+51）
+            std::size_t i = 0;
+            for (; i + 18 <= pixels; i += 16) {
+                const __m256i a = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12)), 1);
+                const __m256i b = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 24))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 36)), 1);
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst),      _mm256_or_si256(_mm256_shuffle_epi8(a, mask), alpha));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), _mm256_or_si256(_mm256_shuffle_epi8(b, mask), alpha));
+
+                src += 48;
+                dst += 64;
+            }
+            // 残り（< 18 画素）は SSSE3 版（はみ出し読みをしない）
+            Rgb24ToRgba32Ssse3(src, dst, pixels - i);
+        }
+
+        #undef ENGINE_ASSET_RGB_TO_RGBA_MASK
+#endif
+
+    } // namespace
+
+    void Rgb24ToRgba32(const std::uint8_t* src, std::uint8_t* dst, std::size_t pixels, SimdLevel level) noexcept {
+        const SimdLevel supported = DetectSimdLevel();
+        if (level > supported) level = supported;
+
+#if defined(ENGINE_ASSET_X86)
+        switch (level) {
+        case SimdLevel::Avx2:  Rgb24ToRgba32Avx2(src, dst, pixels); return;
+        case SimdLevel::Ssse3: Rgb24ToRgba32Ssse3(src, dst, pixels); return;
+        case SimdLevel::Scalar: break;
+        }
+#endif
+        Rgb24ToRgba32Scalar(src, dst, pixels);
+    }
+
+    void Rgb24ToRgba32(const std::uint8_t* src, std::uint8_t* dst, std::size_t pixels) noexcept {
+        Rgb24ToRgba32(src, dst, pixels, DetectSimdLevel());
+    }
+
+} // namespace Engine::Asset::Detail
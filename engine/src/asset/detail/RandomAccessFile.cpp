@@ -0,0 +1,190 @@
+#include "engine/asset/detail/RandomAccessFile.hpp"
+
+#include <utility>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define ENGINE_ASSET_HAS_PREAD 1
+#else
+    #include <fstream>
+    #include <mutex>
+#endif
+
+namespace Engine::Asset::Detail {
+
+    using AssetError = RandomAccessFile::AssetError;
+
+#if !defined(_WIN32) && !defined(ENGINE_ASSET_HAS_PREAD)
+    struct RandomAccessFile::Fallback {
+        std::ifstream ifs;
+        std::mutex mtx;
+    };
+#else
+    struct RandomAccessFile::Fallback {};
+#endif
+
+    RandomAccessFile::RandomAccessFile() = default;
+    RandomAccessFile::~RandomAccessFile() { Close(); }
+
+    RandomAccessFile::RandomAccessFile(RandomAccessFile&& other) noexcept
+        : handle_(std::exchange(other.handle_, -1))
+        , size_(std::exchange(other.size_, 0))
+        , path_(std::move(other.path_))
+        , fallback_(std::move(other.fallback_)) {}
+
+    RandomAccessFile& RandomAccessFile::operator=(RandomAccessFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            handle_ = std::exchange(other.handle_, -1);
+            size_ = std::exchange(other.size_, 0);
+            path_ = std::move(other.path_);
+            fallback_ = std::move(other.fallback_);
+        }
+        return *this;
+    }
+
+    bool RandomAccessFile::IsOpen() const noexcept {
+        return handle_ != -1 || fallback_ != nullptr;
+    }
+
+    void RandomAccessFile::Close() noexcept {
+#if defined(_WIN32)
+        if (handle_ != -1) CloseHandle(reinterpret_cast<HANDLE>(handle_));
+#elif defined(ENGINE_ASSET_HAS_PREAD)
+        if (handle_ != -1) ::close(static_cast<int>(handle_));
+#endif
+        handle_ = -1;
+        size_ = 0;
+        fallback_.reset();
+    }
+
+    Base::Result<void, AssetError> RandomAccessFile::Open(std::string_view path) {
+        Close();
+        path_ = std::string(path);
+
+#if defined(_WIN32)
+        HANDLE h = CreateFileA(path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                               OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (h == INVALID_HANDLE_VALUE) {
+            const DWORD err = GetLastError();
+            const auto code = (err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND)
+                            ? AssetErrorCode::SourceNotFound : AssetErrorCode::SourceReadFailed;
+            return Base::Result<void, AssetError>::Err(AssetError::Make(code, "RandomAccessFile: cannot open file", path_));
+        }
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(h, &size)) {
+            CloseHandle(h);
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "RandomAccessFile: cannot get file size", path_));
+        }
+        handle_ = reinterpret_cast<std::intptr_t>(h);
+        size_ = static_cast<std::uint64_t>(size.QuadPart);
+
+#elif defined(ENGINE_ASSET_HAS_PREAD)
+        const int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            const auto code = (errno == ENOENT || errno == ENOTDIR)
+                            ? AssetErrorCode::SourceNotFound : AssetErrorCode::SourceReadFailed;
+            return Base::Result<void, AssetError>::Err(AssetError::Make(code, "RandomAccessFile: cannot open file", path_));
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "RandomAccessFile: cannot get file size", path_));
+        }
+        handle_ = fd;
+        size_ = static_cast<std::uint64_t>(st.st_size);
+
+#else
+        auto fb = std::make_unique<Fallback>();
+        fb->ifs.open(path_, std::ios::in | std::ios::binary);
+        if (!fb->ifs) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceNotFound, "RandomAccessFile: cannot open file", path_));
+        }
+        fb->ifs.seekg(0, std::ios::end);
+        const auto end = fb->ifs.tellg();
+        if (end < 0) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "RandomAccessFile: cannot get file size", path_));
+        }
+        size_ = static_cast<std::uint64_t>(end);
+        fallback_ = std::move(fb);
+#endif
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+    Base::Result<void, AssetError> RandomAccessFile::ReadAt(std::uint64_t offset, void* dst, std::size_t size) const {
+        if (!IsOpen()) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InternalError, "RandomAccessFile: not open", path_));
+        }
+        if (offset > size_ || size > size_ - offset) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "RandomAccessFile: read past end of file", path_));
+        }
+
+        auto* out = static_cast<unsigned char*>(dst);
+        std::size_t done = 0;
+
+#if defined(_WIN32)
+        HANDLE h = reinterpret_cast<HANDLE>(handle_);
+        while (done < size) {
+            const std::uint64_t pos = offset + done;
+            const std::size_t chunk = size - done;
+            const DWORD want = static_cast<DWORD>(chunk > 0x40000000u ? 0x40000000u : chunk);
+
+            OVERLAPPED ov{};
+            ov.Offset = static_cast<DWORD>(pos & 0xFFFFFFFFull);
+            ov.OffsetHigh = static_cast<DWORD>(pos >> 32);
+            DWORD got = 0;
+            if (!ReadFile(h, out + done, want, &got, &ov) || got == 0) {
+                return Base::Result<void, AssetError>::Err(
+                    AssetError::Make(AssetErrorCode::SourceReadFailed, "RandomAccessFile: ReadFile failed", path_));
+            }
+            done += got;
+        }
+
+#elif defined(ENGINE_ASSET_HAS_PREAD)
+        const int fd = static_cast<int>(handle_);
+        while (done < size) {
+            const ssize_t got = ::pread(fd, out + done, size - done, static_cast<off_t>(offset + done));
+            if (got < 0) {
+                if (errno == EINTR) continue;
+                return Base::Result<void, AssetError>::Err(
+                    AssetError::Make(AssetErrorCode::SourceReadFailed, "RandomAccessFile: pread failed", path_));
+            }
+            if (got == 0) {
+                return Base::Result<void, AssetError>::Err(
+                    AssetError::Make(AssetErrorCode::SourceReadFailed, "RandomAccessFile: unexpected end of file", path_));
+            }
+            done += static_cast<std::size_t>(got);
+        }
+
+#else
+        std::lock_guard<std::mutex> lock(fallback_->mtx);
+        fallback_->ifs.clear();
+        fallback_->ifs.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+        if (!fallback_->ifs.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(size))) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "RandomAccessFile: read failed", path_));
+        }
+        done = size;
+#endif
+        (void)done;
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+} // namespace Engine::Asset::Detail
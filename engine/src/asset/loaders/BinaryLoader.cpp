@@ -1,17 +1,24 @@
 #include "engine/asset/loaders/BinaryLoader.hpp"
 
+#include "engine/asset/detail/ResidentSize.hpp"
+
 namespace Engine::Asset::Loaders {
     using AssetError = Base::Error<AssetErrorCode>;
 
     AssetType BinaryLoader::GetType() const noexcept {
-        static const AssetType kType = AssetType::FromString("binary");
-        return kType;
+        return "binary"_atype;
+    }
+
+    std::uint64_t BinaryLoader::ResidentBytes(const Core::AnyAsset& asset) const noexcept {
+        const auto* a = asset.As<BinaryAsset>();
+        if (!a) return 0;
+        return sizeof(BinaryAsset) + Detail::BlobHeapBytes(a->data);
     }
 
     Base::Result<Core::AnyAsset, AssetError>
     BinaryLoader::Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
         auto bin = std::make_shared<BinaryAsset>();
-        bin->bytes.assign(bytes.begin(), bytes.end());
+        bin->data = Detail::ByteBlob::Copy(bytes);
 
         (void)ctx;
         return Base::Result<Core::AnyAsset, AssetError>::Ok(
@@ -19,4 +26,17 @@ namespace Engine::Asset::Loaders {
         );
     }
 
+    Base::Result<Core::AnyAsset, AssetError>
+    BinaryLoader::LoadView(const Loading::SourceView& src, const Loading::LoadContext& ctx) {
+        // 寿命を握れないビューはコピーするしかない
+        if (!src.owner) return Load(src.bytes, ctx);
+
+        auto bin = std::make_shared<BinaryAsset>();
+        bin->data = Detail::ByteBlob::Borrow(src.bytes, src.owner);
+
+        return Base::Result<Core::AnyAsset, AssetError>::Ok(
+            Core::AnyAsset::FromShared<BinaryAsset>(std::move(bin))
+        );
+    }
+
 } // namespace Engine::Asset::Loaders
@@ -1,11 +1,18 @@
 #include "engine/asset/loaders/FontLoader.hpp"
 
+#include "engine/asset/detail/ResidentSize.hpp"
+
 namespace Engine::Asset::Loaders {
     using AssetError = Base::Error<AssetErrorCode>;
 
     AssetType FontLoader::GetType() const noexcept {
-        static const AssetType kType = AssetType::FromString("font");
-        return kType;
+        return "font"_atype;
+    }
+
+    std::uint64_t FontLoader::ResidentBytes(const Core::AnyAsset& asset) const noexcept {
+        const auto* a = asset.As<FontAsset>();
+        if (!a) return 0;
+        return sizeof(FontAsset) + Detail::BlobHeapBytes(a->data);
     }
 
     Base::Result<Core::AnyAsset, AssetError>
@@ -16,7 +23,25 @@ namespace Engine::Asset::Loaders {
         }
 
         auto font = std::make_shared<FontAsset>();
-        font->bytes.assign(bytes.begin(), bytes.end());
+        font->data = Detail::ByteBlob::Copy(bytes);
+
+        return Base::Result<Core::AnyAsset, AssetError>::Ok(
+            Core::AnyAsset::FromShared<FontAsset>(std::move(font))
+        );
+    }
+
+    Base::Result<Core::AnyAsset, AssetError>
+    FontLoader::LoadView(const Loading::SourceView& src, const Loading::LoadContext& ctx) {
+        // 寿命を握れないビューはコピーするしかない
+        if (!src.owner) return Load(src.bytes, ctx);
+
+        if (src.bytes.empty()) {
+            return Base::Result<Core::AnyAsset, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::DecodeFailed, "Font: empty file", ctx.resolvedPath));
+        }
+
+        auto font = std::make_shared<FontAsset>();
+        font->data = Detail::ByteBlob::Borrow(src.bytes, src.owner);
 
         return Base::Result<Core::AnyAsset, AssetError>::Ok(
             Core::AnyAsset::FromShared<FontAsset>(std::move(font))
@@ -1,44 +1,58 @@
 #include "engine/asset/loaders/SoundLoader.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstring>
+#include <vector>
+
+#include "engine/asset/detail/PcmConvert.hpp"
+#include "engine/asset/detail/WavFormat.hpp"
 
 namespace Engine::Asset::Loaders {
 
-    static std::uint16_t ReadU16LE(const unsigned char* p) {
-        return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
-    }
-    static std::uint32_t ReadU32LE(const unsigned char* p) {
-        return static_cast<std::uint32_t>(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24));
-    }
+    using Detail::ReadU16LE;
+    using Detail::ReadU32LE;
 
-    AssetType SoundLoader::GetType() const noexcept {
-        static const AssetType kType = AssetType::FromString("sound");
-        return kType;
+    using WavResult = Base::Result<std::shared_ptr<SoundAsset>, AssetError>;
+
+    // 検証済みの WAV の中身（dataPtr は入力バイト列を指す）
+    struct WavLayout {
+        std::uint32_t sampleRate = 0;
+        std::uint16_t channels = 0;
+        const unsigned char* dataPtr = nullptr;
+        std::uint32_t dataSize = 0;
+    };
+    using LayoutResult = Base::Result<WavLayout, AssetError>;
+
+    // fmt の検証（Load と増分 decoder で同じ順・同じエラー）
+    static bool ValidateFormat(std::uint16_t audioFormat, std::uint16_t channels, std::uint16_t bitsPerSample,
+                               const Loading::LoadContext& ctx, AssetError& out) {
+        if (const char* msg = Detail::CheckWavPcm16(audioFormat, channels, bitsPerSample)) {
+            out = AssetError::Make(AssetErrorCode::UnsupportedFormat, msg, ctx.resolvedPath);
+            return false;
+        }
+        return true;
     }
 
-    Base::Result<Core::AnyAsset, AssetError>
-    SoundLoader::Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
+    // WAV(PCM16) のヘッダを読んで data チャンクの位置を返す
+    static LayoutResult ParseWav(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
         const auto* p = reinterpret_cast<const unsigned char*>(bytes.data());
         const std::size_t n = bytes.size();
 
         if (n < 12) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
+            return LayoutResult::Err(
                 AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: file too small", ctx.resolvedPath));
         }
 
         if (std::memcmp(p, "RIFF", 4) != 0 || std::memcmp(p + 8, "WAVE", 4) != 0) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
+            return LayoutResult::Err(
                 AssetError::Make(AssetErrorCode::UnsupportedFormat, "Sound: only WAV(RIFF/WAVE) supported (PCM16)", ctx.resolvedPath));
         }
 
         std::uint16_t audioFormat = 0;
-        std::uint16_t channels = 0;
-        std::uint32_t sampleRate = 0;
         std::uint16_t bitsPerSample = 0;
-
-        const unsigned char* dataPtr = nullptr;
-        std::uint32_t dataSize = 0;
+        WavLayout layout;
 
         std::size_t off = 12;
         while (off + 8 <= n) {
@@ -50,59 +64,241 @@ namespace Engine::Asset::Loaders {
 
             if (std::memcmp(ck, "fmt ", 4) == 0) {
                 if (ckSize < 16) {
-                    return Base::Result<Core::AnyAsset, AssetError>::Err(
+                    return LayoutResult::Err(
                         AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: invalid fmt chunk", ctx.resolvedPath));
                 }
-                audioFormat   = ReadU16LE(p + off + 0);
-                channels      = ReadU16LE(p + off + 2);
-                sampleRate    = ReadU32LE(p + off + 4);
-                bitsPerSample = ReadU16LE(p + off + 14);
+                audioFormat       = ReadU16LE(p + off + 0);
+                layout.channels   = ReadU16LE(p + off + 2);
+                layout.sampleRate = ReadU32LE(p + off + 4);
+                bitsPerSample     = ReadU16LE(p + off + 14);
             } else if (std::memcmp(ck, "data", 4) == 0) {
-                dataPtr = p + off;
-                dataSize = ckSize;
+                layout.dataPtr = p + off;
+                layout.dataSize = ckSize;
             }
 
             // チャンクは word align（奇数なら+1）
             off += ckSize + (ckSize & 1u);
         }
 
-        if (audioFormat != 1) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only PCM supported", ctx.resolvedPath));
-        }
-        if (channels == 0 || (channels != 1 && channels != 2)) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only mono/stereo supported", ctx.resolvedPath));
-        }
-        if (bitsPerSample != 16) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
-                AssetError::Make(AssetErrorCode::UnsupportedFormat, "WAV: only 16-bit supported", ctx.resolvedPath));
+        if (AssetError err; !ValidateFormat(audioFormat, layout.channels, bitsPerSample, ctx, err)) {
+            return LayoutResult::Err(std::move(err));
         }
-        if (!dataPtr || dataSize == 0) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
+        if (!layout.dataPtr || layout.dataSize == 0) {
+            return LayoutResult::Err(
                 AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: missing data chunk", ctx.resolvedPath));
         }
-        if ((dataSize % 2) != 0) {
-            return Base::Result<Core::AnyAsset, AssetError>::Err(
+        if ((layout.dataSize % 2) != 0) {
+            return LayoutResult::Err(
                 AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: data size not aligned", ctx.resolvedPath));
         }
+        return LayoutResult::Ok(layout);
+    }
+
+    // WAV(PCM16) を decode する（サンプルは所有コピー）
+    static WavResult DecodeWav(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
+        auto parsed = ParseWav(bytes, ctx);
+        if (!parsed) return WavResult::Err(std::move(parsed.error()));
+        const WavLayout& layout = parsed.value();
 
-        const std::size_t sampleCount = dataSize / 2;
+        const std::size_t sampleCount = layout.dataSize / 2;
         auto snd = std::make_shared<SoundAsset>();
-        snd->sampleRate = sampleRate;
-        snd->channels = channels;
+        snd->sampleRate = layout.sampleRate;
+        snd->channels = layout.channels;
         snd->pcm16.resize(sampleCount);
+        Detail::Pcm16LeToNative(layout.dataPtr, snd->pcm16.data(), sampleCount);
+
+        return WavResult::Ok(std::move(snd));
+    }
+
+    // PCM16 の増分 decoder
+    // - data チャンクの先頭までを溜めてヘッダを読み、以降はチャンクごとにサンプルへ変換する
+    // - data が fmt より前 / 検証エラーなどは溜めたまま Finish で DecodeWav に任せる（エラー内容を Load と揃える）
+    class WavStreamDecoder final : public Loading::IStreamDecoder {
+    public:
+        WavStreamDecoder(const Loading::LoadContext& ctx, std::uint64_t totalBytes)
+            : ctx_(ctx), totalBytes_(totalBytes) {}
+
+        Base::Result<void, AssetError> Feed(Detail::ConstSpan<std::byte> chunk) override {
+            if (state_ == State::Body) {
+                ConsumeBody_(reinterpret_cast<const unsigned char*>(chunk.data()), chunk.size());
+                return Base::Result<void, AssetError>::Ok();
+            }
+
+            pending_.insert(pending_.end(), chunk.begin(), chunk.end());
+            if (state_ == State::Header) TryHeader_();
+            return Base::Result<void, AssetError>::Ok();
+        }
+
+        Base::Result<Core::AnyAsset, AssetError> Finish() override {
+            if (state_ != State::Body) {
+                auto decoded = DecodeWav(Detail::ConstSpan<std::byte>{ pending_.data(), pending_.size() }, ctx_);
+                if (!decoded) return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(decoded.error()));
+                return Base::Result<Core::AnyAsset, AssetError>::Ok(
+                    Core::AnyAsset::FromShared<SoundAsset>(std::move(decoded.value())));
+            }
+
+            if (consumed_ < dataSize_) {
+                // data チャンクが途中で切れている：Load では data 無し扱い
+                return Base::Result<Core::AnyAsset, AssetError>::Err(
+                    AssetError::Make(AssetErrorCode::DecodeFailed, "WAV: missing data chunk", ctx_.resolvedPath));
+            }
+            return Base::Result<Core::AnyAsset, AssetError>::Ok(
+                Core::AnyAsset::FromShared<SoundAsset>(std::move(snd_)));
+        }
+
+    private:
+        enum class State : std::uint8_t { Header, Body, Buffered };
+
+        void TryHeader_() {
+            const auto* p = reinterpret_cast<const unsigned char*>(pending_.data());
+            const std::size_t n = pending_.size();
+
+            switch (Detail::ScanWavHeader(p, n, header_)) {
+            case Detail::WavScan::Found:
+                StartBody_(header_.dataOffset, header_.dataSize);
+                return;
+            case Detail::WavScan::NotWav:
+            case Detail::WavScan::BadFmt:
+                state_ = State::Buffered;
+                return;
+            case Detail::WavScan::NeedMore:
+                break;
+            }
+            if (n > kMaxHeaderBytes) state_ = State::Buffered;
+        }
 
-        // little-endian PCM16 を int16 に変換
-        for (std::size_t i = 0; i < sampleCount; ++i) {
-            const unsigned char* s = dataPtr + i * 2;
-            std::uint16_t u = static_cast<std::uint16_t>(s[0] | (s[1] << 8));
-            snd->pcm16[i] = static_cast<std::int16_t>(u);
+        void StartBody_(std::size_t dataOffset, std::uint32_t dataSize) {
+            AssetError err;
+            const bool truncated = totalBytes_ != 0 && dataOffset + dataSize > totalBytes_;
+            if (!header_.haveFmt || truncated || dataSize == 0 || (dataSize % 2) != 0 ||
+                !ValidateFormat(header_.audioFormat, header_.channels, header_.bitsPerSample, ctx_, err)) {
+                state_ = State::Buffered;
+                return;
+            }
+
+            snd_ = std::make_shared<SoundAsset>();
+            snd_->sampleRate = header_.sampleRate;
+            snd_->channels = header_.channels;
+            if (totalBytes_ != 0) {
+                snd_->pcm16.resize(dataSize / 2);
+            } else {
+                // サイズ不明の source ではヘッダの値を信用しきらない（届いた分だけ伸ばす）
+                snd_->pcm16.reserve(std::min<std::size_t>(dataSize / 2, kMaxBlindReserve));
+            }
+            dataSize_ = dataSize;
+            state_ = State::Body;
+
+            std::vector<std::byte> rest(pending_.begin() + static_cast<std::ptrdiff_t>(dataOffset), pending_.end());
+            pending_.clear();
+            pending_.shrink_to_fit();
+            ConsumeBody_(reinterpret_cast<const unsigned char*>(rest.data()), rest.size());
+        }
+
+        void ConsumeBody_(const unsigned char* src, std::size_t n) {
+            if (consumed_ + n > dataSize_) n = static_cast<std::size_t>(dataSize_ - consumed_);
+            consumed_ += n;
+
+            auto& pcm = snd_->pcm16;
+            if (n > 0 && hasCarry_) {
+                const unsigned char pair[2] = { carry_, src[0] };
+                Reserve_(1);
+                Detail::Pcm16LeToNative(pair, pcm.data() + sampleIndex_, 1);
+                ++sampleIndex_;
+                hasCarry_ = false;
+                ++src;
+                --n;
+            }
+
+            // little-endian PCM16 を int16 に変換（届いた分をまとめて）
+            const std::size_t whole = n / 2;
+            if (whole > 0) {
+                Reserve_(whole);
+                Detail::Pcm16LeToNative(src, pcm.data() + sampleIndex_, whole);
+                sampleIndex_ += whole;
+            }
+            if (n & 1u) {
+                carry_ = src[n - 1];
+                hasCarry_ = true;
+            }
+        }
+
+        // サイズ不明の source 向け：書き込み先を sampleIndex_ + count まで伸ばす
+        void Reserve_(std::size_t count) {
+            auto& pcm = snd_->pcm16;
+            if (sampleIndex_ + count > pcm.size()) pcm.resize(sampleIndex_ + count);
+        }
+
+        static constexpr std::size_t kMaxHeaderBytes = 64 * 1024;
+        static constexpr std::size_t kMaxBlindReserve = 1u << 20;
+
+        Loading::LoadContext ctx_;
+        std::uint64_t totalBytes_ = 0;
+        State state_ = State::Header;
+        std::vector<std::byte> pending_;
+
+        Detail::WavHeader header_{};
+
+        std::shared_ptr<SoundAsset> snd_;
+        std::uint64_t dataSize_ = 0;
+        std::uint64_t consumed_ = 0;
+        std::size_t sampleIndex_ = 0;
+        unsigned char carry_ = 0;
+        bool hasCarry_ = false;
+    };
+
+    AssetType SoundLoader::GetType() const noexcept {
+        return "sound"_atype;
+    }
+
+    std::uint64_t SoundLoader::ResidentBytes(const Core::AnyAsset& asset) const noexcept {
+        const auto* a = asset.As<SoundAsset>();
+        if (!a) return 0;
+        const std::size_t samples = a->keepAlive ? a->view.size() : a->pcm16.capacity();
+        return sizeof(SoundAsset) + samples * sizeof(std::int16_t);
+    }
+
+    Base::Result<Core::AnyAsset, AssetError>
+    SoundLoader::Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
+        auto decoded = DecodeWav(bytes, ctx);
+        if (!decoded) {
+            return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(decoded.error()));
         }
 
         return Base::Result<Core::AnyAsset, AssetError>::Ok(
-            Core::AnyAsset::FromShared<SoundAsset>(std::move(snd))
+            Core::AnyAsset::FromShared<SoundAsset>(std::move(decoded.value()))
         );
     }
 
+    Base::Result<Core::AnyAsset, AssetError>
+    SoundLoader::LoadView(const Loading::SourceView& src, const Loading::LoadContext& ctx) {
+        // 寿命を握れないビュー / big-endian ホストはコピーするしかない
+        if (!opt_.aliasSourceBytes || !src.owner || std::endian::native != std::endian::little) {
+            return Load(src.bytes, ctx);
+        }
+
+        auto parsed = ParseWav(src.bytes, ctx);
+        if (!parsed) return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(parsed.error()));
+        const WavLayout& layout = parsed.value();
+
+        // int16 として読めない位置（奇数アドレス）ならコピー
+        if ((reinterpret_cast<std::uintptr_t>(layout.dataPtr) % alignof(std::int16_t)) != 0) {
+            return Load(src.bytes, ctx);
+        }
+
+        auto snd = std::make_shared<SoundAsset>();
+        snd->sampleRate = layout.sampleRate;
+        snd->channels = layout.channels;
+        snd->view = Detail::ConstSpan<std::int16_t>{
+            reinterpret_cast<const std::int16_t*>(layout.dataPtr), layout.dataSize / 2 };
+        snd->keepAlive = src.owner;
+
+        return Base::Result<Core::AnyAsset, AssetError>::Ok(
+            Core::AnyAsset::FromShared<SoundAsset>(std::move(snd)));
+    }
+
+    std::unique_ptr<Loading::IStreamDecoder>
+    SoundLoader::BeginStream(const Loading::LoadContext& ctx, std::uint64_t totalBytes) {
+        return std::make_unique<WavStreamDecoder>(ctx, totalBytes);
+    }
+
 } // namespace Engine::Asset::Loaders
@@ -0,0 +1,199 @@
+#include "engine/asset/loaders/SoundStreamLoader.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "engine/asset/detail/PcmConvert.hpp"
+#include "engine/asset/detail/ResidentSize.hpp"
+#include "engine/asset/detail/WavFormat.hpp"
+
+namespace Engine::Asset::Loaders {
+
+    using AssetResult = Base::Result<Core::AnyAsset, AssetError>;
+
+    // 溜めたヘッダから asset を作る（エラーは SoundLoader と同じ文言）
+    // p/n に data チャンクのヘッダが無ければデータ無し扱い
+    static AssetResult MakeStreamingAsset(const unsigned char* p, std::size_t n, std::uint64_t totalBytes,
+                                          const Loading::LoadContext& ctx, Loading::IAssetSource& source,
+                                          const SoundStreamLoader::Options& opt) {
+        auto fail = [&](AssetErrorCode code, const char* msg) {
+            return AssetResult::Err(AssetError::Make(code, msg, ctx.resolvedPath));
+        };
+
+        Detail::WavHeader h;
+        const Detail::WavScan scan = Detail::ScanWavHeader(p, n, h);
+        if (n < 12) return fail(AssetErrorCode::DecodeFailed, "WAV: file too small");
+        if (scan == Detail::WavScan::NotWav) {
+            return fail(AssetErrorCode::UnsupportedFormat, "Sound: only WAV(RIFF/WAVE) supported (PCM16)");
+        }
+        if (scan == Detail::WavScan::BadFmt) return fail(AssetErrorCode::DecodeFailed, "WAV: invalid fmt chunk");
+        if (scan == Detail::WavScan::NeedMore) {
+            if (const char* msg = Detail::CheckWavPcm16(h.audioFormat, h.channels, h.bitsPerSample)) {
+                return fail(AssetErrorCode::UnsupportedFormat, msg);
+            }
+            return fail(AssetErrorCode::DecodeFailed, "WAV: missing data chunk");
+        }
+
+        // data が fmt より前にあると本体を読み飛ばさないと fmt に届かない：ストリーミングでは扱わない
+        if (!h.haveFmt) {
+            return fail(AssetErrorCode::UnsupportedFormat, "WAV(stream): fmt chunk must precede data");
+        }
+        if (const char* msg = Detail::CheckWavPcm16(h.audioFormat, h.channels, h.bitsPerSample)) {
+            return fail(AssetErrorCode::UnsupportedFormat, msg);
+        }
+        const bool truncated = totalBytes != 0 && h.dataOffset + std::uint64_t{ h.dataSize } > totalBytes;
+        if (h.dataSize == 0 || truncated) return fail(AssetErrorCode::DecodeFailed, "WAV: missing data chunk");
+        if ((h.dataSize % 2) != 0) return fail(AssetErrorCode::DecodeFailed, "WAV: data size not aligned");
+
+        auto snd = std::make_shared<StreamingSoundAsset>();
+        snd->sampleRate = h.sampleRate;
+        snd->channels = h.channels;
+        snd->totalSamples = h.dataSize / 2;
+        snd->source = &source;
+        snd->resolvedPath = ctx.resolvedPath;
+        snd->dataOffset = h.dataOffset;
+        snd->ringSamples = opt.ringSamples;
+        snd->readAheadSamples = opt.readAheadSamples;
+        return AssetResult::Ok(Core::AnyAsset::FromShared<StreamingSoundAsset>(std::move(snd)));
+    }
+
+    // ヘッダだけ読む増分 decoder
+    // - data チャンクのヘッダが揃った時点で NeedsMoreInput=false（本体は読ませない）
+    class WavHeaderDecoder final : public Loading::IStreamDecoder {
+    public:
+        WavHeaderDecoder(const Loading::LoadContext& ctx, std::uint64_t totalBytes,
+                         Loading::IAssetSource& source, const SoundStreamLoader::Options& opt)
+            : ctx_(ctx), totalBytes_(totalBytes), source_(source), opt_(opt) {}
+
+        Base::Result<void, AssetError> Feed(Detail::ConstSpan<std::byte> chunk) override {
+            if (done_) return Base::Result<void, AssetError>::Ok();
+
+            pending_.insert(pending_.end(), chunk.begin(), chunk.end());
+            Detail::WavHeader h;
+            const auto scan = Detail::ScanWavHeader(
+                reinterpret_cast<const unsigned char*>(pending_.data()), pending_.size(), h);
+            done_ = scan != Detail::WavScan::NeedMore || pending_.size() > kMaxHeaderBytes;
+            return Base::Result<void, AssetError>::Ok();
+        }
+
+        bool NeedsMoreInput() const noexcept override { return !done_; }
+
+        AssetResult Finish() override {
+            return MakeStreamingAsset(reinterpret_cast<const unsigned char*>(pending_.data()), pending_.size(),
+                                      totalBytes_, ctx_, source_, opt_);
+        }
+
+    private:
+        static constexpr std::size_t kMaxHeaderBytes = 64 * 1024;
+
+        Loading::LoadContext ctx_;
+        std::uint64_t totalBytes_ = 0;
+        Loading::IAssetSource& source_;
+        SoundStreamLoader::Options opt_;
+        std::vector<std::byte> pending_;
+        bool done_ = false;
+    };
+
+    // ---- SoundStreamReader ----
+
+    SoundStreamReader::SoundStreamReader(const StreamingSoundAsset& asset)
+        : SoundStreamReader(asset, asset.ringSamples, asset.readAheadSamples) {}
+
+    SoundStreamReader::SoundStreamReader(const StreamingSoundAsset& asset, std::size_t ringSamples, std::size_t readAheadSamples)
+        : source_(asset.source)
+        , path_(asset.resolvedPath)
+        , dataOffset_(asset.dataOffset)
+        , total_(asset.totalSamples) {
+        ring_.resize(std::max<std::size_t>(ringSamples, 1));
+        readAhead_ = std::min(readAheadSamples, ring_.size());
+    }
+
+    Base::Result<void, AssetError> SoundStreamReader::Fill_() {
+        // 最初の refill で 1 回だけ開き、以後の refill はこのハンドルから読む
+        if (!range_ && pos_ + size_ < total_) {
+            auto opened = source_->OpenRange(path_);
+            if (!opened) return Base::Result<void, AssetError>::Err(std::move(opened.error()));
+            range_ = std::move(opened.value());
+        }
+
+        const std::size_t cap = ring_.size();
+        while (size_ < cap && pos_ + size_ < total_) {
+            const std::size_t tail = (head_ + size_) % cap;
+            const std::uint64_t next = pos_ + size_;
+            const std::size_t want = static_cast<std::size_t>(
+                std::min<std::uint64_t>(std::min(cap - size_, cap - tail), total_ - next));
+
+            std::int16_t* dst = ring_.data() + tail;
+            auto r = range_->ReadAt(dataOffset_ + next * 2,
+                                    Detail::Span<std::byte>{ reinterpret_cast<std::byte*>(dst), want * 2 });
+            if (!r) return Base::Result<void, AssetError>::Err(std::move(r.error()));
+
+            const std::size_t got = r.value() / 2;
+            if (got == 0) {
+                // ヘッダより実ファイルが短い（ロード後に差し替えられた等）：読めた所で終端にする
+                total_ = next;
+                break;
+            }
+            if constexpr (std::endian::native != std::endian::little) {
+                Detail::ByteSwap16(reinterpret_cast<const std::uint8_t*>(dst), dst, got);
+            }
+            size_ += got;
+        }
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+    Base::Result<std::size_t, AssetError> SoundStreamReader::Read(Detail::Span<std::int16_t> dst) {
+        const std::size_t cap = ring_.size();
+        std::size_t done = 0;
+        while (done < dst.size()) {
+            if (size_ <= readAhead_) {
+                auto f = Fill_();
+                if (!f) return Base::Result<std::size_t, AssetError>::Err(std::move(f.error()));
+            }
+            if (size_ == 0) break;
+
+            const std::size_t n = std::min({ dst.size() - done, size_, cap - head_ });
+            std::memcpy(dst.data() + done, ring_.data() + head_, n * sizeof(std::int16_t));
+            head_ = (head_ + n) % cap;
+            size_ -= n;
+            pos_ += n;
+            done += n;
+        }
+        return Base::Result<std::size_t, AssetError>::Ok(done);
+    }
+
+    Base::Result<void, AssetError> SoundStreamReader::Prefetch() {
+        return Fill_();
+    }
+
+    void SoundStreamReader::Seek(std::uint64_t sampleIndex) noexcept {
+        pos_ = std::min(sampleIndex, total_);
+        head_ = 0;
+        size_ = 0;
+    }
+
+    // ---- SoundStreamLoader ----
+
+    AssetType SoundStreamLoader::GetType() const noexcept {
+        return "sound_stream"_atype;
+    }
+
+    // サンプルは持たないのでヘッダ情報と path だけ（再生中の reader のリングは各 reader の持ち物）
+    std::uint64_t SoundStreamLoader::ResidentBytes(const Core::AnyAsset& asset) const noexcept {
+        const auto* a = asset.As<StreamingSoundAsset>();
+        if (!a) return 0;
+        return sizeof(StreamingSoundAsset) + Detail::StringHeapBytes(a->resolvedPath);
+    }
+
+    AssetResult SoundStreamLoader::Load(Detail::ConstSpan<std::byte> bytes, const Loading::LoadContext& ctx) {
+        return MakeStreamingAsset(reinterpret_cast<const unsigned char*>(bytes.data()), bytes.size(),
+                                  bytes.size(), ctx, source_, opt_);
+    }
+
+    std::unique_ptr<Loading::IStreamDecoder>
+    SoundStreamLoader::BeginStream(const Loading::LoadContext& ctx, std::uint64_t totalBytes) {
+        return std::make_unique<WavHeaderDecoder>(ctx, totalBytes, source_, opt_);
+    }
+
+} // namespace Engine::Asset::Loaders
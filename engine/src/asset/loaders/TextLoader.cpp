@@ -1,11 +1,18 @@
 #include "engine/asset/loaders/TextLoader.hpp"
 
+#include "engine/asset/detail/ResidentSize.hpp"
+
 namespace Engine::Asset::Loaders {
     using AssetError = Base::Error<AssetErrorCode>;
 
     AssetType TextLoader::GetType() const noexcept {
-        static const AssetType kType = AssetType::FromString("text");
-        return kType;
+        return "text"_atype;
+    }
+
+    std::uint64_t TextLoader::ResidentBytes(const Core::AnyAsset& asset) const noexcept {
+        const auto* a = asset.As<TextAsset>();
+        if (!a) return 0;
+        return sizeof(TextAsset) + Detail::StringHeapBytes(a->text);
     }
 
     Base::Result<Core::AnyAsset, AssetError>
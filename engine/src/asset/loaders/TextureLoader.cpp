@@ -4,6 +4,10 @@
 #include <cstring>
 #include <string>
 #include <string_view>
+#include <vector>
+
+#include "engine/asset/detail/AsciiScan.hpp"
+#include "engine/asset/detail/PixelConvert.hpp"
 
 namespace Engine::Asset::Loaders {
 
@@ -99,20 +103,22 @@ namespace Engine::Asset::Loaders {
                     AssetError::Make(AssetErrorCode::DecodeFailed, "PPM(P6): body too small", ctx.resolvedPath));
             }
 
-            const unsigned char* src = reinterpret_cast<const unsigned char*>(p);
-            std::size_t di = 0;
-            for (std::size_t si = 0; si < need; si += 3) {
-                tex->rgba[di + 0] = src[si + 0];
-                tex->rgba[di + 1] = src[si + 1];
-                tex->rgba[di + 2] = src[si + 2];
-                tex->rgba[di + 3] = 255;
-                di += 4;
-            }
+            Detail::Rgb24ToRgba32(reinterpret_cast<const std::uint8_t*>(p), tex->rgba.data(),
+                                  static_cast<std::size_t>(w) * static_cast<std::size_t>(h));
             return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Ok(std::move(tex));
         }
 
         // P3 (ASCII)
-        // 注意：遅いが最小実装としてOK
+        // 速い経路：数字と空白だけなら SIMD 分類 + 分岐なし組み立てで一気に読む
+        {
+            const char* q = p;
+            if (Detail::ParseAsciiRgbToRgba(q, end, tex->rgba.data(),
+                                            static_cast<std::size_t>(w) * static_cast<std::size_t>(h))) {
+                return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Ok(std::move(tex));
+            }
+        }
+
+        // 逐次パーサ：コメント / 符号付き / 範囲外 / 途中終端など（エラー内容はここで決める）
         std::size_t di = 0;
         for (int i = 0; i < w * h; ++i) {
             int r = 0, g = 0, b = 0;
@@ -133,10 +139,134 @@ namespace Engine::Asset::Loaders {
         return Base::Result<std::shared_ptr<TextureAsset>, AssetError>::Ok(std::move(tex));
     }
 
+    // P6 の増分 decoder
+    // - ヘッダが揃うまでは溜める。揃ったら出力を確保し、以降はチャンクごとに RGB -> RGBA
+    // - P6 以外 / ヘッダ不正などは溜めたまま Finish で DecodePPM に任せる（エラー内容を Load と揃える）
+    class PpmStreamDecoder final : public Loading::IStreamDecoder {
+    public:
+        explicit PpmStreamDecoder(const Loading::LoadContext& ctx) : ctx_(ctx) {}
+
+        Base::Result<void, AssetError> Feed(Detail::ConstSpan<std::byte> chunk) override {
+            if (state_ == State::Body) {
+                ConsumeBody_(reinterpret_cast<const unsigned char*>(chunk.data()), chunk.size());
+                return Base::Result<void, AssetError>::Ok();
+            }
+
+            pending_.insert(pending_.end(), chunk.begin(), chunk.end());
+            if (state_ == State::Header) TryHeader_();
+            return Base::Result<void, AssetError>::Ok();
+        }
+
+        Base::Result<Core::AnyAsset, AssetError> Finish() override {
+            if (state_ != State::Body) {
+                auto decoded = DecodePPM(Detail::ConstSpan<std::byte>{ pending_.data(), pending_.size() }, ctx_);
+                if (!decoded) return Base::Result<Core::AnyAsset, AssetError>::Err(std::move(decoded.error()));
+                return Base::Result<Core::AnyAsset, AssetError>::Ok(
+                    Core::AnyAsset::FromShared<TextureAsset>(std::move(decoded.value())));
+            }
+
+            if (written_ < need_) {
+                return Base::Result<Core::AnyAsset, AssetError>::Err(
+                    AssetError::Make(AssetErrorCode::DecodeFailed, "PPM(P6): body too small", ctx_.resolvedPath));
+            }
+            return Base::Result<Core::AnyAsset, AssetError>::Ok(
+                Core::AnyAsset::FromShared<TextureAsset>(std::move(tex_)));
+        }
+
+    private:
+        enum class State : std::uint8_t { Header, Body, Buffered };
+
+        void TryHeader_() {
+            const char* begin = reinterpret_cast<const char*>(pending_.data());
+            const char* end = begin + pending_.size();
+            if (end - begin < 2) return;
+            if (!(begin[0] == 'P' && begin[1] == '6')) {
+                state_ = State::Buffered; // P3 / 非対応は全体を見てから
+                return;
+            }
+
+            const char* p = begin + 2;
+            int w = 0, h = 0, maxv = 0;
+            if (!ReadInt(p, end, w) || !ReadInt(p, end, h) || !ReadInt(p, end, maxv)) {
+                // 途中で切れているだけかもしれない。十分溜めても駄目なら DecodePPM に任せる
+                if (pending_.size() > kMaxHeaderBytes) state_ = State::Buffered;
+                return;
+            }
+            p = SkipCommentsAndSpaces(p, end);
+            if (p >= end) {
+                // maxval の桁 or 空白/コメントが次のチャンクへ続いている可能性がある
+                if (pending_.size() > kMaxHeaderBytes) state_ = State::Buffered;
+                return;
+            }
+            if (w <= 0 || h <= 0 || maxv != 255) {
+                state_ = State::Buffered;
+                return;
+            }
+
+            tex_ = std::make_shared<TextureAsset>();
+            tex_->width = static_cast<std::uint32_t>(w);
+            tex_->height = static_cast<std::uint32_t>(h);
+            tex_->rgba.resize(static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * 4);
+            need_ = static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * 3;
+
+            state_ = State::Body;
+            const std::size_t headerBytes = static_cast<std::size_t>(p - begin);
+            std::vector<std::byte> rest(pending_.begin() + static_cast<std::ptrdiff_t>(headerBytes), pending_.end());
+            pending_.clear();
+            pending_.shrink_to_fit();
+            ConsumeBody_(reinterpret_cast<const unsigned char*>(rest.data()), rest.size());
+        }
+
+        void ConsumeBody_(const unsigned char* src, std::size_t n) {
+            // 余分な末尾は捨てる（Load と同じ）
+            const std::size_t consumed = written_ + carryLen_;
+            if (consumed + n > need_) n = need_ - consumed;
+
+            std::uint8_t* dst = tex_->rgba.data();
+
+            // 前のチャンクから持ち越した端数ピクセル
+            while (n > 0 && carryLen_ > 0) {
+                carry_[carryLen_++] = *src++;
+                --n;
+                if (carryLen_ == 3) {
+                    const std::size_t di = (written_ / 3) * 4;
+                    dst[di + 0] = carry_[0];
+                    dst[di + 1] = carry_[1];
+                    dst[di + 2] = carry_[2];
+                    dst[di + 3] = 255;
+                    written_ += 3;
+                    carryLen_ = 0;
+                }
+            }
+
+            const std::size_t whole = n - (n % 3);
+            Detail::Rgb24ToRgba32(src, dst + (written_ / 3) * 4, whole / 3);
+            written_ += whole;
+
+            for (std::size_t i = whole; i < n; ++i) carry_[carryLen_++] = src[i];
+        }
+
+        static constexpr std::size_t kMaxHeaderBytes = 4096;
+
+        Loading::LoadContext ctx_;
+        State state_ = State::Header;
+        std::vector<std::byte> pending_;
+
+        std::shared_ptr<TextureAsset> tex_;
+        std::size_t need_ = 0;     // 本体のバイト数（w*h*3）
+        std::size_t written_ = 0;  // 本体のうち展開済みのバイト数（端数は含まない）
+        unsigned char carry_[3]{};
+        std::size_t carryLen_ = 0;
+    };
+
     AssetType TextureLoader::GetType() const noexcept {
-        // ここは AssetType 実装に合わせて調整
-        static const AssetType kType = AssetType::FromString("texture");
-        return kType;
+        return "texture"_atype;
+    }
+
+    std::uint64_t TextureLoader::ResidentBytes(const Core::AnyAsset& asset) const noexcept {
+        const auto* a = asset.As<TextureAsset>();
+        if (!a) return 0;
+        return sizeof(TextureAsset) + a->rgba.capacity();
     }
 
     Base::Result<Core::AnyAsset, AssetError>
@@ -151,4 +281,9 @@ namespace Engine::Asset::Loaders {
         );
     }
 
+    std::unique_ptr<Loading::IStreamDecoder>
+    TextureLoader::BeginStream(const Loading::LoadContext& ctx, std::uint64_t /*totalBytes*/) {
+        return std::make_unique<PpmStreamDecoder>(ctx);
+    }
+
 } // namespace Engine::Asset::Loaders
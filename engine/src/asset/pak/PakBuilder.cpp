@@ -0,0 +1,159 @@
+#include "engine/asset/pak/PakBuilder.hpp"
+
+#include <cstring>
+#include <fstream>
+
+#include "engine/asset/pak/PakCompression.hpp"
+
+namespace Engine::Asset::Pak {
+
+    namespace {
+        std::uint64_t AlignUp(std::uint64_t v, std::uint64_t a) noexcept {
+            return (v + (a - 1)) & ~(a - 1);
+        }
+
+        // 負荷率 0.5 以下になる 2 の累乗
+        std::uint32_t SlotCountFor(std::size_t keys) noexcept {
+            std::uint32_t n = 16;
+            while (n < keys * 2) n <<= 1;
+            return n;
+        }
+
+        void InsertSlot(std::vector<Slot>& slots, std::uint64_t key, std::uint32_t entryIndex) {
+            const std::uint32_t mask = static_cast<std::uint32_t>(slots.size() - 1);
+            for (std::uint32_t i = SlotOf(key, mask);; i = (i + 1) & mask) {
+                if (slots[i].entryIndex == kEmptySlot) {
+                    slots[i].key = key;
+                    slots[i].entryIndex = entryIndex;
+                    return;
+                }
+            }
+        }
+    }
+
+    Base::Result<void, AssetError>
+    PakBuilder::Add(const AssetId& id, std::string_view resolvedPath, Detail::ConstSpan<std::byte> bytes) {
+        return Add(id, resolvedPath, bytes, opt_.compression);
+    }
+
+    Base::Result<void, AssetError>
+    PakBuilder::Add(const AssetId& id, std::string_view resolvedPath, Detail::ConstSpan<std::byte> bytes, Compression compression) {
+        if (!id.IsValid() || resolvedPath.empty()) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "PakBuilder: invalid id or path", std::string(resolvedPath)));
+        }
+
+        const std::uint64_t pathKey = PathKey(resolvedPath);
+        if (idKeys_.count(id.value) || pathKeys_.count(pathKey)) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "PakBuilder: duplicated id or path", std::string(resolvedPath)));
+        }
+        // id キーと path キーは同じスロット表に入るので、種類をまたいだ一致も弾く
+        // （同じエントリの id と path が同じ文字列なのは構わない）
+        if (pathKeys_.count(id.value) || idKeys_.count(pathKey)) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InvalidCatalogEntry, "PakBuilder: id collides with another entry's path", std::string(resolvedPath)));
+        }
+
+        Item item;
+        item.idKey = id.value;
+        item.pathKey = pathKey;
+        item.path = std::string(resolvedPath);
+        item.rawSize = bytes.size();
+
+        if (compression == Compression::Lz) {
+            item.stored = CompressLz(bytes);
+            // 縮まなければ無圧縮で持つ
+            if (item.stored.empty()) compression = Compression::None;
+        }
+        if (compression == Compression::None) {
+            item.stored.assign(bytes.begin(), bytes.end());
+        }
+        item.compression = compression;
+
+        idKeys_.insert(item.idKey);
+        pathKeys_.insert(item.pathKey);
+        items_.push_back(std::move(item));
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+    Base::Result<Loading::ByteBuffer, AssetError> PakBuilder::Build() const {
+        const std::uint64_t align = opt_.alignment ? opt_.alignment : 1;
+        if ((align & (align - 1)) != 0) {
+            return Base::Result<Loading::ByteBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::InternalError, "PakBuilder: alignment must be a power of two", ""));
+        }
+
+        // 1) データ配置を決める
+        std::vector<Entry> entries;
+        entries.reserve(items_.size());
+
+        std::uint64_t cursor = kHeaderSize;
+        for (const auto& it : items_) {
+            cursor = AlignUp(cursor, align);
+            Entry e;
+            e.idKey = it.idKey;
+            e.pathKey = it.pathKey;
+            e.offset = cursor;
+            e.storedSize = it.stored.size();
+            e.rawSize = it.rawSize;
+            e.compression = it.compression;
+            entries.push_back(e);
+            cursor += it.stored.size();
+        }
+
+        // 2) ハッシュ表（1 エントリ 2 キー）
+        std::vector<Slot> slots(SlotCountFor(entries.size() * 2));
+        for (std::uint32_t i = 0; i < entries.size(); ++i) {
+            InsertSlot(slots, entries[i].idKey, i);
+            InsertSlot(slots, entries[i].pathKey, i);
+        }
+
+        Header h;
+        h.entryCount = static_cast<std::uint32_t>(entries.size());
+        h.slotCount = static_cast<std::uint32_t>(slots.size());
+        h.alignment = static_cast<std::uint32_t>(align);
+        h.tocOffset = AlignUp(cursor, 8);
+        h.tocSize = entries.size() * kEntrySize + slots.size() * kSlotSize;
+
+        // 3) 書き出し（隙間は 0 埋め）
+        Loading::ByteBuffer out(static_cast<std::size_t>(h.tocOffset + h.tocSize), std::byte{ 0 });
+        WriteHeader(out.data(), h);
+
+        for (std::size_t i = 0; i < items_.size(); ++i) {
+            const auto& stored = items_[i].stored;
+            if (!stored.empty()) std::memcpy(out.data() + entries[i].offset, stored.data(), stored.size());
+        }
+
+        std::byte* p = out.data() + h.tocOffset;
+        for (const auto& e : entries) {
+            WriteEntry(p, e);
+            p += kEntrySize;
+        }
+        for (const auto& s : slots) {
+            WriteSlot(p, s);
+            p += kSlotSize;
+        }
+
+        return Base::Result<Loading::ByteBuffer, AssetError>::Ok(std::move(out));
+    }
+
+    Base::Result<void, AssetError> PakBuilder::WriteToFile(std::string_view path) const {
+        auto built = Build();
+        if (!built) return Base::Result<void, AssetError>::Err(std::move(built.error()));
+
+        const auto& bytes = built.value();
+        std::ofstream ofs(std::string(path), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "PakBuilder: cannot open output", std::string(path)));
+        }
+        ofs.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!ofs) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "PakBuilder: write failed", std::string(path)));
+        }
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+} // namespace Engine::Asset::Pak
@@ -0,0 +1,158 @@
+#include "engine/asset/pak/PakCompression.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace Engine::Asset::Pak {
+
+    namespace {
+        constexpr std::size_t kMinMatch = 4;
+        constexpr std::size_t kLastLiterals = 5;   // 末尾 5 バイトは必ずリテラル
+        constexpr std::size_t kMatchStartLimit = 12;
+        constexpr std::size_t kMaxOffset = 65535;
+        constexpr int kHashBits = 12;
+
+        std::uint32_t Read32(const std::uint8_t* p) noexcept {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        std::uint32_t HashOf(std::uint32_t v) noexcept {
+            return (v * 2654435761u) >> (32 - kHashBits);
+        }
+
+        void PutLength(std::vector<std::byte>& out, std::size_t len) {
+            while (len >= 255) {
+                out.push_back(std::byte{ 255 });
+                len -= 255;
+            }
+            out.push_back(static_cast<std::byte>(len));
+        }
+
+        // シーケンス：token | [lit len+] | literals | [offset(2) | [match len+]]
+        void EmitSequence(std::vector<std::byte>& out,
+                          const std::uint8_t* lit, std::size_t litLen,
+                          std::size_t offset, std::size_t matchLen) {
+            const std::size_t ml = matchLen ? matchLen - kMinMatch : 0;
+            const std::uint8_t token = static_cast<std::uint8_t>(
+                ((litLen >= 15 ? 15 : litLen) << 4) | (ml >= 15 ? 15 : ml));
+            out.push_back(static_cast<std::byte>(token));
+            if (litLen >= 15) PutLength(out, litLen - 15);
+
+            const std::size_t at = out.size();
+            out.resize(at + litLen);
+            if (litLen) std::memcpy(out.data() + at, lit, litLen);
+
+            if (matchLen == 0) return; // 最終シーケンス
+            out.push_back(static_cast<std::byte>(offset & 0xFFu));
+            out.push_back(static_cast<std::byte>((offset >> 8) & 0xFFu));
+            if (ml >= 15) PutLength(out, ml - 15);
+        }
+    }
+
+    std::vector<std::byte> CompressLz(Detail::ConstSpan<std::byte> src) {
+        const auto* in = reinterpret_cast<const std::uint8_t*>(src.data());
+        const std::size_t n = src.size();
+        if (n <= kMatchStartLimit) return {};
+
+        std::vector<std::byte> out;
+        out.reserve(n);
+
+        std::vector<std::int64_t> table(std::size_t{ 1 } << kHashBits, -1);
+
+        const std::size_t matchLimit = n - kMatchStartLimit;
+        const std::size_t extendLimit = n - kLastLiterals;
+
+        std::size_t anchor = 0;
+        std::size_t i = 0;
+        while (i < matchLimit) {
+            const std::uint32_t seq = Read32(in + i);
+            const std::uint32_t h = HashOf(seq);
+            const std::int64_t cand = table[h];
+            table[h] = static_cast<std::int64_t>(i);
+
+            if (cand < 0 || i - static_cast<std::size_t>(cand) > kMaxOffset ||
+                Read32(in + cand) != seq) {
+                ++i;
+                continue;
+            }
+
+            const std::size_t c = static_cast<std::size_t>(cand);
+            std::size_t len = kMinMatch;
+            while (i + len < extendLimit && in[c + len] == in[i + len]) ++len;
+
+            EmitSequence(out, in + anchor, i - anchor, i - c, len);
+            i += len;
+            anchor = i;
+
+            // 縮まないと分かった時点で打ち切る
+            if (out.size() >= n) return {};
+        }
+
+        EmitSequence(out, in + anchor, n - anchor, 0, 0);
+        if (out.size() >= n) return {};
+        return out;
+    }
+
+    Base::Result<void, AssetError> DecompressLz(Detail::ConstSpan<std::byte> src, Detail::Span<std::byte> dst) {
+        const auto* ip = reinterpret_cast<const std::uint8_t*>(src.data());
+        const auto* const iend = ip + src.size();
+        auto* op = reinterpret_cast<std::uint8_t*>(dst.data());
+        auto* const obegin = op;
+        auto* const oend = op + dst.size();
+
+        auto fail = [](const char* what) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::DecodeFailed, "PakCompression: corrupted stream", what));
+        };
+
+        auto readLength = [&](std::size_t& len) -> bool {
+            std::uint8_t b = 0;
+            do {
+                if (ip >= iend) return false;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+            return true;
+        };
+
+        while (ip < iend) {
+            const std::uint8_t token = *ip++;
+
+            std::size_t lit = token >> 4;
+            if (lit == 15 && !readLength(lit)) return fail("literal length");
+            if (lit > static_cast<std::size_t>(iend - ip) || lit > static_cast<std::size_t>(oend - op)) {
+                return fail("literal overrun");
+            }
+            std::memcpy(op, ip, lit);
+            ip += lit;
+            op += lit;
+
+            if (ip == iend) break; // 最終シーケンス
+
+            if (iend - ip < 2) return fail("offset");
+            const std::size_t offset = static_cast<std::size_t>(ip[0]) | (static_cast<std::size_t>(ip[1]) << 8);
+            ip += 2;
+            if (offset == 0 || offset > static_cast<std::size_t>(op - obegin)) return fail("offset range");
+
+            std::size_t ml = token & 0x0Fu;
+            if (ml == 15 && !readLength(ml)) return fail("match length");
+            ml += kMinMatch;
+            if (ml > static_cast<std::size_t>(oend - op)) return fail("match overrun");
+
+            // 重なりがあり得るので前から 1 バイトずつ（offset >= ml なら memcpy）
+            const std::uint8_t* from = op - offset;
+            if (offset >= ml) {
+                std::memcpy(op, from, ml);
+                op += ml;
+            } else {
+                for (std::size_t k = 0; k < ml; ++k) *op++ = from[k];
+            }
+        }
+
+        if (op != oend) return fail("size mismatch");
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+} // namespace Engine::Asset::Pak
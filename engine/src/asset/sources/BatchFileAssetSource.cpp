@@ -0,0 +1,474 @@
+#include "engine/asset/sources/BatchFileAssetSource.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "engine/asset/detail/RandomAccessFile.hpp"
+
+#if defined(__linux__)
+    #include <sys/syscall.h>
+    #if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && __has_include(<linux/io_uring.h>)
+        #include <cerrno>
+        #include <cstring>
+        #include <fcntl.h>
+        #include <linux/io_uring.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <sys/uio.h>
+        #include <unistd.h>
+        #define ENGINE_ASSET_HAS_IO_URING 1
+    #endif
+#endif
+
+namespace Engine::Asset::Sources {
+
+    namespace {
+
+        Loading::SourceView ViewOf(std::shared_ptr<Loading::ByteBuffer> buf) {
+            Loading::SourceView v;
+            v.bytes = Detail::ConstSpan<std::byte>{ buf->data(), buf->size() };
+            v.owner = std::move(buf);
+            return v;
+        }
+
+        // 1 ファイルを pread で丸ごと読む（代用経路）
+        Base::Result<Loading::SourceView, AssetError> PreadWhole(std::string_view path) {
+            Detail::RandomAccessFile file;
+            auto opened = file.Open(path);
+            if (!opened) return Base::Result<Loading::SourceView, AssetError>::Err(std::move(opened.error()));
+
+            auto buf = std::make_shared<Loading::ByteBuffer>(static_cast<std::size_t>(file.Size()));
+            if (!buf->empty()) {
+                auto r = file.ReadAt(0, buf->data(), buf->size());
+                if (!r) return Base::Result<Loading::SourceView, AssetError>::Err(std::move(r.error()));
+            }
+            return Base::Result<Loading::SourceView, AssetError>::Ok(ViewOf(std::move(buf)));
+        }
+
+#if defined(ENGINE_ASSET_HAS_IO_URING)
+        // 最小限の io_uring ラッパ（SQ/CQ を mmap して直接操作する）
+        class Ring final {
+        public:
+            Ring() = default;
+            ~Ring() { Close_(); }
+
+            Ring(const Ring&) = delete;
+            Ring& operator=(const Ring&) = delete;
+
+            bool Init(unsigned entries) {
+                io_uring_params p{};
+                const long fd = ::syscall(__NR_io_uring_setup, entries, &p);
+                if (fd < 0) return false;
+                fd_ = static_cast<int>(fd);
+
+                sqRingSize_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+                cqRingSize_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+                const bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+                if (single) sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+
+                sqRing_ = ::mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+                if (sqRing_ == MAP_FAILED) { sqRing_ = nullptr; Close_(); return false; }
+
+                if (single) {
+                    cqRing_ = sqRing_;
+                } else {
+                    cqRing_ = ::mmap(nullptr, cqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+                    if (cqRing_ == MAP_FAILED) { cqRing_ = nullptr; Close_(); return false; }
+                }
+
+                sqesSize_ = p.sq_entries * sizeof(io_uring_sqe);
+                void* sqes = ::mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+                if (sqes == MAP_FAILED) { Close_(); return false; }
+                sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+                auto* sq = static_cast<char*>(sqRing_);
+                sqHead_  = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+                sqTail_  = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+                sqMask_  = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+                sqArray_ = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+
+                auto* cq = static_cast<char*>(cqRing_);
+                cqHead_ = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+                cqTail_ = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+                cqMask_ = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+                cqes_   = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+
+                entries_ = p.sq_entries;
+                return true;
+            }
+
+            unsigned Entries() const noexcept { return entries_; }
+
+            // readv を 1 件積む（Submit まで kernel には見えない）
+            void PushReadv(int fd, const iovec* iov, std::uint64_t offset, std::uint64_t userData) {
+                const unsigned tail = *sqTail_;
+                const unsigned idx = tail & sqMask_;
+                io_uring_sqe& sqe = sqes_[idx];
+                std::memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = IORING_OP_READV;
+                sqe.fd = fd;
+                sqe.addr = reinterpret_cast<std::uint64_t>(iov);
+                sqe.len = 1;
+                sqe.off = offset;
+                sqe.user_data = userData;
+                sqArray_[idx] = idx;
+                __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+                ++pending_;
+            }
+
+            // 積んだ分を投げ、少なくとも waitMin 件の完了を待つ
+            bool Submit(unsigned waitMin) {
+                while (true) {
+                    const unsigned flags = waitMin ? IORING_ENTER_GETEVENTS : 0u;
+                    const long r = ::syscall(__NR_io_uring_enter, fd_, pending_, waitMin, flags, nullptr, 0);
+                    if (r >= 0) {
+                        pending_ -= static_cast<unsigned>(r) < pending_ ? static_cast<unsigned>(r) : pending_;
+                        return true;
+                    }
+                    if (errno == EINTR || errno == EAGAIN || errno == EBUSY) continue;
+                    return false;
+                }
+            }
+
+            // 完了を 1 件取り出す（無ければ false）
+            bool PopCompletion(std::uint64_t& userData, int& res) {
+                const unsigned head = *cqHead_;
+                const unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+                if (head == tail) return false;
+                const io_uring_cqe& cqe = cqes_[head & cqMask_];
+                userData = cqe.user_data;
+                res = cqe.res;
+                __atomic_store_n(cqHead_, head + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+
+        private:
+            void Close_() {
+                if (sqes_) ::munmap(sqes_, sqesSize_);
+                if (cqRing_ && cqRing_ != sqRing_) ::munmap(cqRing_, cqRingSize_);
+                if (sqRing_) ::munmap(sqRing_, sqRingSize_);
+                if (fd_ >= 0) ::close(fd_);
+                sqes_ = nullptr;
+                sqRing_ = cqRing_ = nullptr;
+                fd_ = -1;
+            }
+
+            int fd_ = -1;
+            unsigned entries_ = 0;
+            unsigned pending_ = 0;
+
+            void* sqRing_ = nullptr;
+            void* cqRing_ = nullptr;
+            std::size_t sqRingSize_ = 0;
+            std::size_t cqRingSize_ = 0;
+            io_uring_sqe* sqes_ = nullptr;
+            std::size_t sqesSize_ = 0;
+
+            unsigned* sqHead_ = nullptr;
+            unsigned* sqTail_ = nullptr;
+            unsigned sqMask_ = 0;
+            unsigned* sqArray_ = nullptr;
+
+            unsigned* cqHead_ = nullptr;
+            unsigned* cqTail_ = nullptr;
+            unsigned cqMask_ = 0;
+            io_uring_cqe* cqes_ = nullptr;
+        };
+#endif
+
+    } // namespace
+
+    struct BatchFileAssetSource::Impl final {
+        Options opt{};
+        Backend backend = Backend::ThreadPool;
+
+        // ---- io_uring：ring は ReadMany ごとに貸し出す ----
+#if defined(ENGINE_ASSET_HAS_IO_URING)
+        std::mutex ringMtx;
+        std::vector<std::unique_ptr<Ring>> freeRings;
+        // 使えなくなった ring と、それがまだ書くかもしれない buffer（ring を先に閉じるため orphans が先）
+        std::vector<std::shared_ptr<Loading::ByteBuffer>> orphans;
+        std::vector<std::unique_ptr<Ring>> brokenRings;
+
+        std::unique_ptr<Ring> AcquireRing() {
+            {
+                std::lock_guard<std::mutex> lock(ringMtx);
+                if (!freeRings.empty()) {
+                    auto r = std::move(freeRings.back());
+                    freeRings.pop_back();
+                    return r;
+                }
+            }
+            auto r = std::make_unique<Ring>();
+            if (!r->Init(opt.queueDepth)) return nullptr;
+            return r;
+        }
+
+        void ReleaseRing(std::unique_ptr<Ring> r) {
+            std::lock_guard<std::mutex> lock(ringMtx);
+            freeRings.push_back(std::move(r));
+        }
+
+        bool ReadManyUring(Detail::ConstSpan<std::string_view> paths, const ReadCallback& onComplete);
+#endif
+
+        // ---- 代用：pread スレッドプール ----
+        std::vector<std::thread> threads;
+        std::mutex poolMtx;
+        std::condition_variable poolCv;
+        std::deque<std::function<void()>> tasks;
+        bool stopping = false;
+
+        void StartPool() {
+            for (std::uint32_t i = 0; i < opt.fallbackThreads; ++i) {
+                threads.emplace_back([this] { PoolMain(); });
+            }
+        }
+
+        void StopPool() {
+            {
+                std::lock_guard<std::mutex> lock(poolMtx);
+                stopping = true;
+            }
+            poolCv.notify_all();
+            for (auto& t : threads) {
+                if (t.joinable()) t.join();
+            }
+            threads.clear();
+        }
+
+        void PoolMain() {
+            while (true) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(poolMtx);
+                    poolCv.wait(lock, [this] { return stopping || !tasks.empty(); });
+                    if (tasks.empty()) return; // stopping
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        void ReadManyPool(Detail::ConstSpan<std::string_view> paths, const ReadCallback& onComplete);
+    };
+
+    void BatchFileAssetSource::Impl::ReadManyPool(Detail::ConstSpan<std::string_view> paths, const ReadCallback& onComplete) {
+        if (threads.empty()) {
+            for (std::size_t i = 0; i < paths.size(); ++i) onComplete(i, PreadWhole(paths[i]));
+            return;
+        }
+
+        std::mutex callbackMtx; // onComplete を同時に呼ばない
+        std::mutex doneMtx;
+        std::condition_variable doneCv;
+        std::size_t remaining = paths.size();
+
+        {
+            std::lock_guard<std::mutex> lock(poolMtx);
+            for (std::size_t i = 0; i < paths.size(); ++i) {
+                tasks.emplace_back([&, i] {
+                    auto r = PreadWhole(paths[i]);
+                    {
+                        std::lock_guard<std::mutex> cb(callbackMtx);
+                        onComplete(i, std::move(r));
+                    }
+                    std::lock_guard<std::mutex> done(doneMtx);
+                    if (--remaining == 0) doneCv.notify_all();
+                });
+            }
+        }
+        poolCv.notify_all();
+
+        std::unique_lock<std::mutex> lock(doneMtx);
+        doneCv.wait(lock, [&] { return remaining == 0; });
+    }
+
+#if defined(ENGINE_ASSET_HAS_IO_URING)
+    bool BatchFileAssetSource::Impl::ReadManyUring(Detail::ConstSpan<std::string_view> paths, const ReadCallback& onComplete) {
+        auto ring = AcquireRing();
+        if (!ring) return false;
+
+        struct Pending final {
+            int fd = -1;
+            std::shared_ptr<Loading::ByteBuffer> buf;
+            std::size_t done = 0;
+            iovec iov{};
+        };
+        std::vector<Pending> pending(paths.size());
+
+        auto fail = [&](std::size_t i, AssetErrorCode code, const char* msg) {
+            if (pending[i].fd >= 0) {
+                ::close(pending[i].fd);
+                pending[i].fd = -1;
+            }
+            pending[i].buf.reset();
+            onComplete(i, Base::Result<Loading::SourceView, AssetError>::Err(
+                AssetError::Make(code, msg, std::string(paths[i]))));
+        };
+
+        auto pushRead = [&](std::size_t i) {
+            Pending& p = pending[i];
+            p.iov.iov_base = p.buf->data() + p.done;
+            p.iov.iov_len = p.buf->size() - p.done;
+            ring->PushReadv(p.fd, &p.iov, p.done, i);
+        };
+
+        const unsigned depth = ring->Entries();
+        std::size_t next = 0;
+        unsigned inFlight = 0;
+        bool broken = false;
+
+        while (next < paths.size() || inFlight > 0) {
+            // 1) 空いている分だけ open して積む（open は同期。fd を抱えすぎないよう投入直前に開く）
+            while (!broken && next < paths.size() && inFlight < depth) {
+                const std::size_t i = next++;
+                const std::string path(paths[i]);
+
+                const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0) {
+                    const auto code = (errno == ENOENT || errno == ENOTDIR)
+                                    ? AssetErrorCode::SourceNotFound : AssetErrorCode::SourceReadFailed;
+                    fail(i, code, "BatchFileAssetSource: cannot open file");
+                    continue;
+                }
+                pending[i].fd = fd;
+
+                struct stat st{};
+                if (::fstat(fd, &st) != 0) {
+                    fail(i, AssetErrorCode::SourceReadFailed, "BatchFileAssetSource: cannot get file size");
+                    continue;
+                }
+
+                pending[i].buf = std::make_shared<Loading::ByteBuffer>(static_cast<std::size_t>(st.st_size));
+                if (pending[i].buf->empty()) {
+                    ::close(fd);
+                    pending[i].fd = -1;
+                    onComplete(i, Base::Result<Loading::SourceView, AssetError>::Ok(ViewOf(std::move(pending[i].buf))));
+                    continue;
+                }
+
+                pushRead(i);
+                ++inFlight;
+            }
+
+            if (inFlight == 0) continue;
+
+            // 2) 投げて 1 件以上の完了を待つ
+            if (!ring->Submit(1)) {
+                // ring が使えなくなった：この ring は捨て、残りは pread で読む
+                broken = true;
+                break;
+            }
+
+            // 3) 刈り取り
+            std::uint64_t userData = 0;
+            int res = 0;
+            while (ring->PopCompletion(userData, res)) {
+                const std::size_t i = static_cast<std::size_t>(userData);
+                Pending& p = pending[i];
+
+                if (res == -EINTR || res == -EAGAIN) {
+                    pushRead(i); // 同じ位置からやり直し
+                    continue;
+                }
+                --inFlight;
+
+                if (res < 0) {
+                    fail(i, AssetErrorCode::SourceReadFailed, "BatchFileAssetSource: read failed");
+                    continue;
+                }
+                if (res == 0) {
+                    fail(i, AssetErrorCode::SourceReadFailed, "BatchFileAssetSource: unexpected end of file");
+                    continue;
+                }
+
+                p.done += static_cast<std::size_t>(res);
+                if (p.done < p.buf->size()) {
+                    pushRead(i); // short read：続きを積む
+                    ++inFlight;
+                    continue;
+                }
+
+                ::close(p.fd);
+                p.fd = -1;
+                onComplete(i, Base::Result<Loading::SourceView, AssetError>::Ok(ViewOf(std::move(p.buf))));
+            }
+        }
+
+        if (broken) {
+            // ring が壊れた：投げ済みの read がまだ buffer に書くかもしれないので、
+            // ring と該当 buffer は Impl が最後まで抱えておき、残りは pread で読み直す
+            {
+                std::lock_guard<std::mutex> lock(ringMtx);
+                for (auto& p : pending) {
+                    if (p.fd >= 0 && p.buf) orphans.push_back(std::move(p.buf));
+                }
+                brokenRings.push_back(std::move(ring));
+            }
+            for (std::size_t i = 0; i < paths.size(); ++i) {
+                Pending& p = pending[i];
+                if (p.fd < 0 && i < next) continue; // 通知済み
+                if (p.fd >= 0) {
+                    ::close(p.fd);
+                    p.fd = -1;
+                }
+                onComplete(i, PreadWhole(paths[i]));
+            }
+            return true;
+        }
+
+        ReleaseRing(std::move(ring));
+        return true;
+    }
+#endif
+
+    BatchFileAssetSource::BatchFileAssetSource()
+        : BatchFileAssetSource(Options{}) {}
+
+    BatchFileAssetSource::BatchFileAssetSource(Options opt)
+        : impl_(std::make_unique<Impl>()) {
+        if (opt.queueDepth == 0) opt.queueDepth = 1;
+        impl_->opt = opt;
+
+#if defined(ENGINE_ASSET_HAS_IO_URING)
+        if (!opt.disableUring) {
+            // 使えるかは実際に ring を作って確かめる（作った ring はそのまま使い回す）
+            if (auto ring = impl_->AcquireRing()) {
+                impl_->ReleaseRing(std::move(ring));
+                impl_->backend = Backend::IoUring;
+            }
+        }
+#endif
+        if (impl_->backend == Backend::ThreadPool) {
+            impl_->StartPool();
+        }
+    }
+
+    BatchFileAssetSource::~BatchFileAssetSource() {
+        impl_->StopPool();
+    }
+
+    BatchFileAssetSource::Backend BatchFileAssetSource::GetBackend() const noexcept {
+        return impl_->backend;
+    }
+
+    void BatchFileAssetSource::ReadMany(Detail::ConstSpan<std::string_view> paths, const ReadCallback& onComplete) {
+        if (paths.empty()) return;
+
+#if defined(ENGINE_ASSET_HAS_IO_URING)
+        if (impl_->backend == Backend::IoUring && impl_->ReadManyUring(paths, onComplete)) {
+            return;
+        }
+#endif
+        impl_->ReadManyPool(paths, onComplete);
+    }
+
+} // namespace Engine::Asset::Sources
@@ -0,0 +1,117 @@
+#include "engine/asset/sources/FileAssetSource.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "engine/asset/detail/RandomAccessFile.hpp"
+
+namespace Engine::Asset::Sources {
+
+    namespace fs = std::filesystem;
+
+    namespace {
+        // 開いたファイルを持ち続ける IRangeReader（ReadAt ごとの open/close をしない）
+        class FileRangeReader final : public Loading::IRangeReader {
+        public:
+            explicit FileRangeReader(Detail::RandomAccessFile file) : file_(std::move(file)) {}
+
+            Base::Result<std::size_t, AssetError>
+            ReadAt(std::uint64_t offset, Detail::Span<std::byte> dst) override {
+                const std::uint64_t total = file_.Size();
+                if (offset >= total) return Base::Result<std::size_t, AssetError>::Ok(std::size_t{ 0 });
+
+                const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(dst.size(), total - offset));
+                auto r = file_.ReadAt(offset, dst.data(), n);
+                if (!r) return Base::Result<std::size_t, AssetError>::Err(std::move(r.error()));
+                return Base::Result<std::size_t, AssetError>::Ok(n);
+            }
+
+        private:
+            Detail::RandomAccessFile file_;
+        };
+    }
+
+    Base::Result<Loading::ByteBuffer, AssetError>
+    FileAssetSource::ReadAll(std::string_view resolvedPath) {
+        const std::string path(resolvedPath);
+
+        std::ifstream ifs(path, std::ios::in | std::ios::binary);
+        if (!ifs) {
+            return Base::Result<Loading::ByteBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceNotFound, "FileAssetSource: cannot open file", path));
+        }
+
+        ifs.seekg(0, std::ios::end);
+        const auto end = ifs.tellg();
+        ifs.seekg(0, std::ios::beg);
+        if (end < 0) {
+            return Base::Result<Loading::ByteBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "FileAssetSource: cannot get file size", path));
+        }
+
+        Loading::ByteBuffer buf(static_cast<std::size_t>(end));
+        if (!buf.empty() && !ifs.read(reinterpret_cast<char*>(buf.data()), static_cast<std::streamsize>(buf.size()))) {
+            return Base::Result<Loading::ByteBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceReadFailed, "FileAssetSource: read failed", path));
+        }
+        return Base::Result<Loading::ByteBuffer, AssetError>::Ok(std::move(buf));
+    }
+
+    Base::Result<void, AssetError>
+    FileAssetSource::ReadChunks(std::string_view resolvedPath, std::size_t chunkBytes, const ChunkCallback& onChunk) {
+        Detail::RandomAccessFile file;
+        auto opened = file.Open(resolvedPath);
+        if (!opened) return opened;
+
+        const std::uint64_t total = file.Size();
+        if (chunkBytes == 0 || chunkBytes > total) chunkBytes = static_cast<std::size_t>(total);
+
+        std::vector<std::byte> buf(chunkBytes);
+        std::uint64_t off = 0;
+        do {
+            const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(chunkBytes, total - off));
+            if (n > 0) {
+                auto r = file.ReadAt(off, buf.data(), n);
+                if (!r) return r;
+            }
+            if (!onChunk(Detail::ConstSpan<std::byte>{ buf.data(), n }, total)) break;
+            off += n;
+        } while (off < total);
+
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+    Base::Result<std::size_t, AssetError>
+    FileAssetSource::ReadRange(std::string_view resolvedPath, std::uint64_t offset, Detail::Span<std::byte> dst) {
+        Detail::RandomAccessFile file;
+        auto opened = file.Open(resolvedPath);
+        if (!opened) return Base::Result<std::size_t, AssetError>::Err(std::move(opened.error()));
+
+        const std::uint64_t total = file.Size();
+        if (offset >= total) return Base::Result<std::size_t, AssetError>::Ok(std::size_t{ 0 });
+
+        const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(dst.size(), total - offset));
+        auto r = file.ReadAt(offset, dst.data(), n);
+        if (!r) return Base::Result<std::size_t, AssetError>::Err(std::move(r.error()));
+        return Base::Result<std::size_t, AssetError>::Ok(n);
+    }
+
+    Base::Result<std::unique_ptr<Loading::IRangeReader>, AssetError>
+    FileAssetSource::OpenRange(std::string_view resolvedPath) {
+        Detail::RandomAccessFile file;
+        auto opened = file.Open(resolvedPath);
+        if (!opened) return Base::Result<std::unique_ptr<Loading::IRangeReader>, AssetError>::Err(std::move(opened.error()));
+        return Base::Result<std::unique_ptr<Loading::IRangeReader>, AssetError>::Ok(
+            std::make_unique<FileRangeReader>(std::move(file)));
+    }
+
+    bool FileAssetSource::Exists(std::string_view resolvedPath) {
+        std::error_code ec;
+        return fs::is_regular_file(fs::path(std::string(resolvedPath)), ec);
+    }
+
+} // namespace Engine::Asset::Sources
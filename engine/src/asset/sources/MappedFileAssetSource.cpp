@@ -0,0 +1,28 @@
+#include "engine/asset/sources/MappedFileAssetSource.hpp"
+
+#include "engine/asset/detail/FileMapping.hpp"
+
+namespace Engine::Asset::Sources {
+
+    Base::Result<Loading::ByteBuffer, AssetError>
+    MappedFileAssetSource::ReadAll(std::string_view resolvedPath) {
+        auto m = Detail::FileMapping::Open(resolvedPath);
+        if (!m) return Base::Result<Loading::ByteBuffer, AssetError>::Err(std::move(m.error()));
+
+        const auto& mapping = *m.value();
+        return Base::Result<Loading::ByteBuffer, AssetError>::Ok(
+            Loading::ByteBuffer(mapping.data(), mapping.data() + mapping.size()));
+    }
+
+    Base::Result<Loading::SourceView, AssetError>
+    MappedFileAssetSource::ReadView(std::string_view resolvedPath) {
+        auto m = Detail::FileMapping::Open(resolvedPath);
+        if (!m) return Base::Result<Loading::SourceView, AssetError>::Err(std::move(m.error()));
+
+        Loading::SourceView v;
+        v.bytes = m.value()->bytes();
+        v.owner = std::move(m.value());
+        return Base::Result<Loading::SourceView, AssetError>::Ok(std::move(v));
+    }
+
+} // namespace Engine::Asset::Sources
@@ -0,0 +1,260 @@
+#include "engine/asset/sources/PakAssetSource.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "engine/asset/pak/PakCompression.hpp"
+
+namespace Engine::Asset::Sources {
+
+    namespace {
+        // 無圧縮エントリの IRangeReader：開きっぱなしの pak に pread するだけ（source が生きている間有効）
+        class PakEntryRangeReader final : public Loading::IRangeReader {
+        public:
+            PakEntryRangeReader(const Detail::RandomAccessFile& file, const Pak::Entry& e)
+                : file_(file), offset_(e.offset), size_(e.rawSize) {}
+
+            Base::Result<std::size_t, AssetError>
+            ReadAt(std::uint64_t offset, Detail::Span<std::byte> dst) override {
+                if (offset >= size_) return Base::Result<std::size_t, AssetError>::Ok(std::size_t{ 0 });
+
+                const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(dst.size(), size_ - offset));
+                auto r = file_.ReadAt(offset_ + offset, dst.data(), n);
+                if (!r) return Base::Result<std::size_t, AssetError>::Err(std::move(r.error()));
+                return Base::Result<std::size_t, AssetError>::Ok(n);
+            }
+
+        private:
+            const Detail::RandomAccessFile& file_;
+            std::uint64_t offset_ = 0;
+            std::uint64_t size_ = 0;
+        };
+
+        // エラー表示用：名前が登録されていなければ（リリースビルドなど）16 進の id
+        std::string IdLabel(const AssetId& id) {
+            const std::string_view name = id.DebugName();
+            if (!name.empty()) return std::string(name);
+            char buf[19];
+            std::snprintf(buf, sizeof(buf), "0x%016llx", static_cast<unsigned long long>(id.value));
+            return buf;
+        }
+    }
+
+    Base::Result<void, AssetError> PakAssetSource::Open(std::string_view pakPath) {
+        entries_.clear();
+        slots_.clear();
+        mask_ = 0;
+
+        auto opened = file_.Open(pakPath);
+        if (!opened) return opened;
+
+        auto bad = [&](const char* msg) {
+            file_.Close();
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::UnsupportedFormat, msg, std::string(pakPath)));
+        };
+
+        if (file_.Size() < Pak::kHeaderSize) return bad("PakAssetSource: file too small");
+
+        std::byte headerBytes[Pak::kHeaderSize];
+        auto rh = file_.ReadAt(0, headerBytes, sizeof(headerBytes));
+        if (!rh) return rh;
+
+        Pak::Header h;
+        if (!Pak::ReadHeader(headerBytes, h)) return bad("PakAssetSource: bad magic");
+        if (h.version != Pak::kVersion) return bad("PakAssetSource: unsupported version");
+
+        const std::uint64_t expectedToc =
+            static_cast<std::uint64_t>(h.entryCount) * Pak::kEntrySize +
+            static_cast<std::uint64_t>(h.slotCount) * Pak::kSlotSize;
+        if (h.slotCount == 0 || (h.slotCount & (h.slotCount - 1)) != 0 ||
+            h.slotCount < static_cast<std::uint64_t>(h.entryCount) * 4 || // 1 エントリ 2 キー、負荷率 <= 0.5
+            h.tocSize != expectedToc ||
+            h.tocOffset > file_.Size() || h.tocSize > file_.Size() - h.tocOffset) {
+            return bad("PakAssetSource: broken table of contents");
+        }
+
+        // TOC は 1 回で読む
+        std::vector<std::byte> toc(static_cast<std::size_t>(h.tocSize));
+        auto rt = file_.ReadAt(h.tocOffset, toc.data(), toc.size());
+        if (!rt) return rt;
+
+        entries_.reserve(h.entryCount);
+        const std::byte* p = toc.data();
+        for (std::uint32_t i = 0; i < h.entryCount; ++i, p += Pak::kEntrySize) {
+            Pak::Entry e = Pak::ReadEntry(p);
+            if (e.offset > h.tocOffset || e.storedSize > h.tocOffset - e.offset) {
+                return bad("PakAssetSource: entry out of range");
+            }
+            if (e.compression == Pak::Compression::None ? e.storedSize != e.rawSize
+                                                        : e.compression != Pak::Compression::Lz) {
+                return bad("PakAssetSource: bad entry compression");
+            }
+            entries_.push_back(e);
+        }
+
+        slots_.reserve(h.slotCount);
+        std::uint32_t emptySlots = 0;
+        for (std::uint32_t i = 0; i < h.slotCount; ++i, p += Pak::kSlotSize) {
+            Pak::Slot s = Pak::ReadSlot(p);
+            if (s.entryIndex == Pak::kEmptySlot) ++emptySlots;
+            else if (s.entryIndex >= h.entryCount) return bad("PakAssetSource: slot out of range");
+            slots_.push_back(s);
+        }
+        // 空きの無い表は見つからないキーの探索が止まらない（壊れた pak）
+        if (emptySlots == 0) return bad("PakAssetSource: slot table has no empty slot");
+        mask_ = h.slotCount - 1;
+
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+    // id キーと path キーは同じ表に入っているので、キーの種類まで一致したエントリだけを返す
+    // （一致しなければ探索を続ける）。Open で空きスロットがあることは確かめているが、探索は表 1 周で打ち切る
+    const Pak::Entry* PakAssetSource::FindById_(std::uint64_t key) const noexcept {
+        if (slots_.empty()) return nullptr;
+        std::uint32_t i = Pak::SlotOf(key, mask_);
+        for (std::uint32_t n = 0; n <= mask_; ++n, i = (i + 1) & mask_) {
+            const auto& s = slots_[i];
+            if (s.entryIndex == Pak::kEmptySlot) return nullptr;
+            if (s.key == key && entries_[s.entryIndex].idKey == key) return &entries_[s.entryIndex];
+        }
+        return nullptr;
+    }
+
+    const Pak::Entry* PakAssetSource::FindByPath_(std::uint64_t key) const noexcept {
+        if (slots_.empty()) return nullptr;
+        std::uint32_t i = Pak::SlotOf(key, mask_);
+        for (std::uint32_t n = 0; n <= mask_; ++n, i = (i + 1) & mask_) {
+            const auto& s = slots_[i];
+            if (s.entryIndex == Pak::kEmptySlot) return nullptr;
+            if (s.key == key && entries_[s.entryIndex].pathKey == key) return &entries_[s.entryIndex];
+        }
+        return nullptr;
+    }
+
+    Base::Result<Loading::ByteBuffer, AssetError>
+    PakAssetSource::ReadEntry_(const Pak::Entry& e, std::string_view what) const {
+        Loading::ByteBuffer out(static_cast<std::size_t>(e.rawSize));
+
+        if (e.compression == Pak::Compression::None) {
+            auto r = file_.ReadAt(e.offset, out.data(), out.size());
+            if (!r) return Base::Result<Loading::ByteBuffer, AssetError>::Err(std::move(r.error()));
+            return Base::Result<Loading::ByteBuffer, AssetError>::Ok(std::move(out));
+        }
+
+        Loading::ByteBuffer stored(static_cast<std::size_t>(e.storedSize));
+        auto r = file_.ReadAt(e.offset, stored.data(), stored.size());
+        if (!r) return Base::Result<Loading::ByteBuffer, AssetError>::Err(std::move(r.error()));
+
+        auto d = Pak::DecompressLz(Detail::ConstSpan<std::byte>{ stored.data(), stored.size() },
+                                   Detail::Span<std::byte>{ out.data(), out.size() });
+        if (!d) {
+            auto err = std::move(d.error());
+            err.detail = std::string(what);
+            return Base::Result<Loading::ByteBuffer, AssetError>::Err(std::move(err));
+        }
+        return Base::Result<Loading::ByteBuffer, AssetError>::Ok(std::move(out));
+    }
+
+    Base::Result<Loading::ByteBuffer, AssetError>
+    PakAssetSource::ReadAll(std::string_view resolvedPath) {
+        const Pak::Entry* e = FindByPath_(Pak::PathKey(resolvedPath));
+        if (!e) {
+            return Base::Result<Loading::ByteBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceNotFound, "PakAssetSource: not in pak", std::string(resolvedPath)));
+        }
+        return ReadEntry_(*e, resolvedPath);
+    }
+
+    Base::Result<Loading::ByteBuffer, AssetError>
+    PakAssetSource::ReadById(const AssetId& id) {
+        const Pak::Entry* e = FindById_(id.value);
+        if (!e) {
+            return Base::Result<Loading::ByteBuffer, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceNotFound, "PakAssetSource: id not in pak", IdLabel(id)));
+        }
+        return ReadEntry_(*e, IdLabel(id));
+    }
+
+    Base::Result<void, AssetError>
+    PakAssetSource::ReadChunks(std::string_view resolvedPath, std::size_t chunkBytes, const ChunkCallback& onChunk) {
+        const Pak::Entry* e = FindByPath_(Pak::PathKey(resolvedPath));
+        if (!e) {
+            return Base::Result<void, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceNotFound, "PakAssetSource: not in pak", std::string(resolvedPath)));
+        }
+        if (e->compression != Pak::Compression::None) {
+            return IAssetSource::ReadChunks(resolvedPath, chunkBytes, onChunk);
+        }
+
+        const std::uint64_t total = e->rawSize;
+        if (chunkBytes == 0 || chunkBytes > total) chunkBytes = static_cast<std::size_t>(total);
+
+        std::vector<std::byte> buf(chunkBytes);
+        std::uint64_t off = 0;
+        do {
+            const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(chunkBytes, total - off));
+            if (n > 0) {
+                auto r = file_.ReadAt(e->offset + off, buf.data(), n);
+                if (!r) return r;
+            }
+            if (!onChunk(Detail::ConstSpan<std::byte>{ buf.data(), n }, total)) break;
+            off += n;
+        } while (off < total);
+
+        return Base::Result<void, AssetError>::Ok();
+    }
+
+    Base::Result<std::size_t, AssetError>
+    PakAssetSource::ReadRange(std::string_view resolvedPath, std::uint64_t offset, Detail::Span<std::byte> dst) {
+        const Pak::Entry* e = FindByPath_(Pak::PathKey(resolvedPath));
+        if (!e) {
+            return Base::Result<std::size_t, AssetError>::Err(
+                AssetError::Make(AssetErrorCode::SourceNotFound, "PakAssetSource: not in pak", std::string(resolvedPath)));
+        }
+        if (e->compression != Pak::Compression::None) {
+            return IAssetSource::ReadRange(resolvedPath, offset, dst);
+        }
+
+        const std::uint64_t total = e->rawSize;
+        if (offset >= total) return Base::Result<std::size_t, AssetError>::Ok(std::size_t{ 0 });
+
+        const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(dst.size(), total - offset));
+        auto r = file_.ReadAt(e->offset + offset, dst.data(), n);
+        if (!r) return Base::Result<std::size_t, AssetError>::Err(std::move(r.error()));
+        return Base::Result<std::size_t, AssetError>::Ok(n);
+    }
+
+    Base::Result<std::unique_ptr<Loading::IRangeReader>, AssetError>
+    PakAssetSource::OpenRange(std::string_view resolvedPath) {
+        using R = Base::Result<std::unique_ptr<Loading::IRangeReader>, AssetError>;
+
+        const Pak::Entry* e = FindByPath_(Pak::PathKey(resolvedPath));
+        if (!e) {
+            return R::Err(AssetError::Make(AssetErrorCode::SourceNotFound, "PakAssetSource: not in pak", std::string(resolvedPath)));
+        }
+        if (e->compression == Pak::Compression::None) {
+            return R::Ok(std::make_unique<PakEntryRangeReader>(file_, *e));
+        }
+
+        // 圧縮エントリはここで 1 回だけ展開し、reader が展開後のバッファを持つ
+        auto r = ReadEntry_(*e, resolvedPath);
+        if (!r) return R::Err(std::move(r.error()));
+        auto buf = std::make_shared<const Loading::ByteBuffer>(std::move(r.value()));
+        Loading::SourceView v;
+        v.bytes = Detail::ConstSpan<std::byte>{ buf->data(), buf->size() };
+        v.owner = std::move(buf);
+        return R::Ok(std::make_unique<Loading::ViewRangeReader>(std::move(v)));
+    }
+
+    bool PakAssetSource::Exists(std::string_view resolvedPath) {
+        return FindByPath_(Pak::PathKey(resolvedPath)) != nullptr;
+    }
+
+    bool PakAssetSource::Contains(const AssetId& id) const noexcept {
+        return FindById_(id.value) != nullptr;
+    }
+
+} // namespace Engine::Asset::Sources
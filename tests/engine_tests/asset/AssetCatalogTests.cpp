@@ -2,15 +2,23 @@
 
 #include <filesystem>
 #include <fstream>
+#include <type_traits>
 
 #include "engine/asset/AssetCatalog.hpp"
+#include "engine/asset/catalog/CatalogCompiler.hpp"
 #include "engine/asset/catalog/CatalogParser.hpp"
 #include "engine/asset/resolver/AssetPathResolver.hpp"
 #include "engine/asset/AssetId.hpp"
+#include "engine/asset/AssetType.hpp"
 
 namespace fs = std::filesystem;
 using Engine::Asset::AssetCatalog;
 using Engine::Asset::AssetId;
+using Engine::Asset::AssetType;
+using namespace Engine::Asset::Literals;
+using Engine::Asset::Catalog::CatalogCompiler;
+using Engine::Asset::Catalog::CatalogEntry;
+using Engine::Asset::Catalog::CatalogEntryView;
 using Engine::Asset::Catalog::CatalogParser;
 using Engine::Asset::Resolver::AssetPathResolver;
 
@@ -73,3 +81,269 @@ TEST_CASE("AssetCatalog: duplicate id should fail") {
     CHECK(!r);
     CHECK(r.error().code == Engine::Asset::AssetErrorCode::InvalidCatalogEntry);
 }
+
+TEST_CASE("AssetCatalog: ids are 8-byte values; names are interned and collisions fail the build") {
+    static_assert(sizeof(AssetId) == 8);
+    static_assert(std::is_trivially_copyable_v<AssetId>);
+
+    fs::path tmp = fs::temp_directory_path() / "asset_catalog_test_names";
+    fs::remove_all(tmp);
+
+    fs::path assetsRoot = tmp / "assets";
+    fs::path catalogPath = tmp / "config/engine/asset_catalog.json";
+
+    AssetPathResolver::Options options;
+    options.assetsRoot = assetsRoot.string();
+    AssetPathResolver resolver(options);
+    CatalogParser parser;
+
+    WriteText(catalogPath, R"({
+      "assets":[
+        {"id":"names.hero","type":"texture","path":"hero.ppm"}
+      ]
+    })");
+    AssetCatalog catalog;
+    REQUIRE(catalog.LoadFromFile(catalogPath.string(), parser, resolver));
+    CHECK(AssetId(Engine::Asset::Detail::Fnv1a64("names.hero")).DebugName() == "names.hero");
+
+    // 別の名前が同じハッシュで登録済み = 衝突（実際の FNV 衝突の代わりに表へ直接入れておく）
+    using Engine::Asset::Detail::NameTable;
+    const auto key = Engine::Asset::Detail::Fnv1a64("names.victim");
+    CHECK(Engine::Asset::Detail::AssetIdNames().Intern(key, "names.squatter") == NameTable::InternResult::Added);
+    CHECK(Engine::Asset::Detail::AssetIdNames().Intern(key, "names.squatter") == NameTable::InternResult::Existing);
+
+    WriteText(catalogPath, R"({
+      "assets":[
+        {"id":"names.victim","type":"texture","path":"victim.ppm"}
+      ]
+    })");
+    AssetCatalog collided;
+    auto r = collided.LoadFromFile(catalogPath.string(), parser, resolver);
+    REQUIRE(!r);
+    CHECK(r.error().code == Engine::Asset::AssetErrorCode::InvalidCatalogEntry);
+    CHECK(r.error().message == "AssetCatalog: id hash collision");
+}
+
+TEST_CASE("AssetCatalog: _aid/_atype literals hash at compile time and match FromString") {
+    constexpr AssetId hero = "lit.hero"_aid;
+    constexpr AssetType tex = "texture"_atype;
+    static_assert(hero.IsValid());
+    static_assert(tex == AssetType::Texture());
+    static_assert("lit.hero"_aid != "lit.heroine"_aid);
+
+    CHECK(hero == AssetId::FromString("lit.hero"));
+    CHECK(tex == AssetType::FromString("texture"));
+#if ENGINE_ASSET_DEBUG_NAME
+    // 名前は静的初期化で登録済み（FromString を通していない名前でも引ける）
+    CHECK("lit.only_literal"_aid.DebugName() == "lit.only_literal");
+    CHECK("lit_only_type"_atype.DebugName() == "lit_only_type");
+#endif
+
+    fs::path tmp = fs::temp_directory_path() / "asset_catalog_test_literals";
+    fs::remove_all(tmp);
+    fs::path catalogPath = tmp / "config/engine/asset_catalog.json";
+
+    AssetPathResolver::Options options;
+    options.assetsRoot = (tmp / "assets").string();
+    AssetPathResolver resolver(options);
+    CatalogParser parser;
+
+    WriteText(catalogPath, R"({
+      "assets":[
+        {"id":"lit.hero","type":"texture","path":"hero.ppm"}
+      ]
+    })");
+    AssetCatalog catalog;
+    REQUIRE(catalog.LoadFromFile(catalogPath.string(), parser, resolver));
+    const auto* e = catalog.Find(hero);
+    REQUIRE(e != nullptr);
+    CHECK(e->type == tex);
+}
+
+TEST_CASE("AssetCatalog: compiled catalog answers the same as the JSON one") {
+    fs::path tmp = fs::temp_directory_path() / "asset_catalog_test_compiled";
+    fs::remove_all(tmp);
+    fs::path catalogPath = tmp / "config/engine/asset_catalog.json";
+    fs::path compiledPath = tmp / "asset_catalog.bin";
+
+    AssetPathResolver::Options options;
+    options.assetsRoot = (tmp / "assets").string();
+    AssetPathResolver resolver(options);
+    CatalogParser parser;
+
+    WriteText(catalogPath, R"({
+      "assets":[
+        {"id":"ui.title","type":"text","path":"ui/title.txt"},
+        {"id":"player_tex","type":"texture","path":"textures/player.ppm"},
+        {"id":"bgm.main","type":"sound_stream","path":"sound/main.wav"}
+      ]
+    })");
+    AssetCatalog json;
+    REQUIRE(json.LoadFromFile(catalogPath.string(), parser, resolver));
+
+    CatalogCompiler compiler;
+    REQUIRE(compiler.AddCatalog(json));
+    CHECK(!compiler.AddCatalog(json)); // 同じ id の二重登録
+    REQUIRE(compiler.WriteToFile(compiledPath.string()));
+
+    AssetCatalog compiled;
+    REQUIRE(compiled.LoadCompiled(compiledPath.string()));
+    CHECK(compiled.IsCompiled());
+    CHECK(compiled.Size() == 3);
+
+    for (const auto* e : json.Entries()) {
+        CatalogEntryView v;
+        REQUIRE(compiled.FindView(e->id, v));
+        CHECK(v.id == e->id);
+        CHECK(v.type == e->type);
+        CHECK(v.sourcePath == e->sourcePath);
+        CHECK(v.resolvedPath == e->resolvedPath);
+    }
+
+    CatalogEntryView none;
+    CHECK(!compiled.FindView("ui.missing"_aid, none));
+    CHECK(compiled.Find("ui.missing"_aid) == nullptr);
+
+    // Find / Entries は CatalogEntry に写して返す
+    const auto* e = compiled.Find("player_tex"_aid);
+    REQUIRE(e != nullptr);
+    CHECK(e->type == "texture"_atype);
+    CHECK(e == compiled.Find("player_tex"_aid));
+    CHECK(compiled.Entries().size() == 3);
+
+    // 再ロードで JSON に戻せる
+    REQUIRE(compiled.LoadFromFile(catalogPath.string(), parser, resolver));
+    CHECK(!compiled.IsCompiled());
+    CHECK(compiled.Size() == 3);
+}
+
+TEST_CASE("AssetCatalog: compiled perfect hash covers many ids; broken files are rejected") {
+    fs::path tmp = fs::temp_directory_path() / "asset_catalog_test_compiled_many";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+    fs::path compiledPath = tmp / "many.bin";
+
+    constexpr int kCount = 20000;
+    CatalogCompiler compiler;
+    for (int i = 0; i < kCount; ++i) {
+        CatalogEntry e;
+        e.id = AssetId::FromString("many." + std::to_string(i));
+        e.type = (i % 2) ? AssetType::Texture() : AssetType::Sound();
+        e.sourcePath = "p/" + std::to_string(i);
+        e.resolvedPath = "assets/p/" + std::to_string(i);
+        REQUIRE(compiler.Add(e));
+    }
+    REQUIRE(compiler.WriteToFile(compiledPath.string()));
+
+    AssetCatalog catalog;
+    REQUIRE(catalog.LoadCompiled(compiledPath.string()));
+    CHECK(catalog.Size() == kCount);
+
+    int found = 0;
+    for (int i = 0; i < kCount; ++i) {
+        CatalogEntryView v;
+        if (catalog.FindView(AssetId::FromString("many." + std::to_string(i)), v) &&
+            v.resolvedPath == "assets/p/" + std::to_string(i) &&
+            v.type == ((i % 2) ? AssetType::Texture() : AssetType::Sound())) {
+            ++found;
+        }
+    }
+    CHECK(found == kCount);
+
+    int falsePositives = 0;
+    for (int i = 0; i < 1000; ++i) {
+        CatalogEntryView v;
+        if (catalog.FindView(AssetId::FromString("absent." + std::to_string(i)), v)) ++falsePositives;
+    }
+    CHECK(falsePositives == 0);
+
+    // 空の catalog
+    fs::path emptyPath = tmp / "empty.bin";
+    REQUIRE(CatalogCompiler().WriteToFile(emptyPath.string()));
+    AssetCatalog empty;
+    REQUIRE(empty.LoadCompiled(emptyPath.string()));
+    CatalogEntryView v;
+    CHECK(!empty.FindView("many.0"_aid, v));
+
+    // 途中で切れたファイル / JSON を渡した場合
+    fs::path cutPath = tmp / "cut.bin";
+    {
+        std::ifstream ifs(compiledPath.string(), std::ios::binary);
+        std::string all((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        WriteText(cutPath, all.substr(0, all.size() / 2));
+    }
+    AssetCatalog broken;
+    auto r = broken.LoadCompiled(cutPath.string());
+    REQUIRE(!r);
+    CHECK(r.error().code == Engine::Asset::AssetErrorCode::ParseFailed);
+    CHECK(!broken.IsCompiled());
+
+    fs::path jsonPath = tmp / "catalog.json";
+    WriteText(jsonPath, R"({"assets":[]})" "                                                                ");
+    CHECK(!broken.LoadCompiled(jsonPath.string()));
+}
+
+TEST_CASE("AssetCatalog: parallel build matches serial build and reports the first error") {
+    fs::path tmp = fs::temp_directory_path() / "asset_catalog_test_parallel";
+    fs::remove_all(tmp);
+
+    fs::path catalogPath = tmp / "asset_catalog.json";
+    AssetPathResolver::Options options;
+    options.assetsRoot = (tmp / "assets").string();
+    AssetPathResolver resolver(options);
+    CatalogParser parser;
+
+    constexpr int kCount = 5000;
+    auto makeCatalog = [&](int dupAt, int badPathAt) {
+        std::string json = R"({"assets":[)";
+        for (int i = 0; i < kCount; ++i) {
+            if (i) json += ",";
+            const int idNum = (i == dupAt) ? 3 : i;
+            const std::string path = (i == badPathAt) ? "/abs/out.txt" : "p/./" + std::to_string(i) + ".txt";
+            json += R"({"id":"par.)" + std::to_string(idNum) + R"(","type":"text","path":")" + path + R"("})";
+        }
+        json += "]}";
+        WriteText(catalogPath, json);
+    };
+
+    AssetCatalog::Options serialOpt;
+    serialOpt.buildThreads = 1;
+    AssetCatalog::Options parallelOpt;
+    parallelOpt.buildThreads = 4;
+    parallelOpt.minEntriesPerBuildThread = 16;
+
+    makeCatalog(-1, -1);
+    AssetCatalog serial(serialOpt);
+    AssetCatalog parallel(parallelOpt);
+    REQUIRE(serial.LoadFromFile(catalogPath.string(), parser, resolver));
+    REQUIRE(parallel.LoadFromFile(catalogPath.string(), parser, resolver));
+    REQUIRE(parallel.Size() == kCount);
+
+    int same = 0;
+    for (int i = 0; i < kCount; ++i) {
+        const auto id = AssetId::FromString("par." + std::to_string(i));
+        const auto* a = serial.Find(id);
+        const auto* b = parallel.Find(id);
+        if (a && b && a->resolvedPath == b->resolvedPath && a->sourcePath == b->sourcePath && a->type == b->type) ++same;
+    }
+    CHECK(same == kCount);
+
+    // 重複が前、不正 path（絶対パス）が後（別スレッドの範囲）：スレッド数によらず先頭側の重複が報告される
+    makeCatalog(4000, 4500);
+    for (auto opt : { serialOpt, parallelOpt }) {
+        AssetCatalog c(opt);
+        auto r = c.LoadFromFile(catalogPath.string(), parser, resolver);
+        REQUIRE(!r);
+        CHECK(r.error().code == Engine::Asset::AssetErrorCode::InvalidCatalogEntry);
+    }
+
+    // 逆順：不正 path が先
+    makeCatalog(4500, 100);
+    for (auto opt : { serialOpt, parallelOpt }) {
+        AssetCatalog c(opt);
+        auto r = c.LoadFromFile(catalogPath.string(), parser, resolver);
+        REQUIRE(!r);
+        CHECK(r.error().code == Engine::Asset::AssetErrorCode::InvalidPath);
+        CHECK(r.error().detail == "par.100");
+    }
+}
@@ -0,0 +1,494 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/AssetType.hpp"
+#include "engine/asset/detail/AsciiScan.hpp"
+#include "engine/asset/detail/PcmConvert.hpp"
+#include "engine/asset/detail/PixelConvert.hpp"
+#include "engine/asset/loaders/SoundLoader.hpp"
+#include "engine/asset/loaders/SoundStreamLoader.hpp"
+#include "engine/asset/loaders/TextureLoader.hpp"
+#include "engine/asset/loading/AssetPipeline.hpp"
+#include "engine/asset/loading/LoaderRegistry.hpp"
+#include "engine/asset/sources/FileAssetSource.hpp"
+#include "engine/asset/sources/MappedFileAssetSource.hpp"
+
+namespace fs = std::filesystem;
+using namespace Engine::Asset;
+
+static void WriteBytes(const fs::path& p, const std::string& s) {
+    fs::create_directories(p.parent_path());
+    std::ofstream ofs(p.string(), std::ios::binary);
+    ofs << s;
+}
+
+static std::string MakeP6(int w, int h, const std::string& header = "") {
+    std::string s = "P6\n" + header + std::to_string(w) + " " + std::to_string(h) + "\n255\n";
+    for (int i = 0; i < w * h * 3; ++i) s.push_back(static_cast<char>((i * 7 + 1) & 0xFF));
+    return s;
+}
+
+static std::string MakeWav(std::uint16_t channels, std::uint32_t samples) {
+    auto u16 = [](std::string& s, std::uint16_t v) { s.push_back(char(v & 0xFF)); s.push_back(char(v >> 8)); };
+    auto u32 = [&](std::string& s, std::uint32_t v) { u16(s, std::uint16_t(v & 0xFFFF)); u16(s, std::uint16_t(v >> 16)); };
+
+    std::string s = "RIFF";
+    u32(s, 0);
+    s += "WAVE";
+    s += "LIST";
+    u32(s, 3);
+    s += "abc";
+    s.push_back('\0'); // word align
+    s += "fmt ";
+    u32(s, 16);
+    u16(s, 1);
+    u16(s, channels);
+    u32(s, 44100);
+    u32(s, 44100 * channels * 2);
+    u16(s, std::uint16_t(channels * 2));
+    u16(s, 16);
+    s += "data";
+    u32(s, samples * 2);
+    for (std::uint32_t i = 0; i < samples; ++i) u16(s, std::uint16_t(i * 523u - 7000u));
+    return s;
+}
+
+struct PipelineFixture {
+    Sources::FileAssetSource source;
+    Loading::LoaderRegistry registry;
+    Loading::AssetPipeline pipeline{ source, registry };
+
+    PipelineFixture() {
+        registry.Register(std::make_unique<Loaders::TextureLoader>());
+        registry.Register(std::make_unique<Loaders::SoundLoader>());
+    }
+
+    Engine::Base::Result<Core::AnyAsset, Loading::AssetError>
+    Load(const fs::path& path, const char* type, std::size_t chunkBytes) {
+        Loading::AssetPipeline::Options opt;
+        opt.streamChunkBytes = chunkBytes;
+        pipeline.SetOptions(opt);
+
+        Loading::LoadContext ctx;
+        ctx.id = AssetId::FromString(path.filename().string());
+        ctx.type = AssetType::FromString(type);
+        ctx.resolvedPath = path.string();
+        return pipeline.Load(ctx);
+    }
+};
+
+TEST_CASE("Streaming decode: P6 and PCM16 match whole-buffer decode for any chunk size") {
+    fs::path tmp = fs::temp_directory_path() / "asset_loader_test_stream";
+    fs::remove_all(tmp);
+    WriteBytes(tmp / "a.ppm", MakeP6(13, 7, "# comment\n"));
+    WriteBytes(tmp / "a.wav", MakeWav(2, 1001));
+
+    PipelineFixture f;
+
+    auto texWhole = f.Load(tmp / "a.ppm", "texture", 0);
+    auto sndWhole = f.Load(tmp / "a.wav", "sound", 0);
+    REQUIRE(texWhole);
+    REQUIRE(sndWhole);
+    const auto* tw = texWhole.value().As<Loaders::TextureAsset>();
+    const auto* sw = sndWhole.value().As<Loaders::SoundAsset>();
+    REQUIRE(tw != nullptr);
+    REQUIRE(sw != nullptr);
+
+    for (std::size_t chunk : { std::size_t{ 1 }, std::size_t{ 2 }, std::size_t{ 3 }, std::size_t{ 5 }, std::size_t{ 64 }, std::size_t{ 4096 } }) {
+        INFO(chunk);
+        auto t = f.Load(tmp / "a.ppm", "texture", chunk);
+        REQUIRE(t);
+        const auto* ts = t.value().As<Loaders::TextureAsset>();
+        REQUIRE(ts != nullptr);
+        CHECK(ts->width == tw->width);
+        CHECK(ts->height == tw->height);
+        CHECK(ts->rgba == tw->rgba);
+
+        auto s = f.Load(tmp / "a.wav", "sound", chunk);
+        REQUIRE(s);
+        const auto* ss = s.value().As<Loaders::SoundAsset>();
+        REQUIRE(ss != nullptr);
+        CHECK(ss->channels == 2);
+        CHECK(ss->sampleRate == 44100);
+        const auto got = ss->Samples();
+        const auto expect = sw->Samples();
+        CHECK(std::equal(got.begin(), got.end(), expect.begin(), expect.end()));
+    }
+}
+
+TEST_CASE("Streaming decode: errors match whole-buffer decode") {
+    fs::path tmp = fs::temp_directory_path() / "asset_loader_test_stream_err";
+    fs::remove_all(tmp);
+
+    std::string shortBody = MakeP6(8, 8);
+    shortBody.resize(shortBody.size() - 10);
+    WriteBytes(tmp / "short.ppm", shortBody);
+    WriteBytes(tmp / "p3.ppm", "P3\n1 1\n255\n1 2 3\n");
+    WriteBytes(tmp / "bad.ppm", "P6\n0 4\n255\nxxxx");
+
+    std::string cutWav = MakeWav(1, 100);
+    cutWav.resize(cutWav.size() - 20);
+    WriteBytes(tmp / "cut.wav", cutWav);
+    std::string threeChannels = MakeWav(3, 10);
+    WriteBytes(tmp / "three.wav", threeChannels);
+
+    PipelineFixture f;
+    for (const char* name : { "short.ppm", "p3.ppm", "bad.ppm", "cut.wav", "three.wav" }) {
+        INFO(name);
+        const char* type = fs::path(name).extension() == ".ppm" ? "texture" : "sound";
+        auto whole = f.Load(tmp / name, type, 0);
+        auto streamed = f.Load(tmp / name, type, 3);
+        CHECK(bool(whole) == bool(streamed));
+        if (!whole && !streamed) {
+            CHECK(whole.error().code == streamed.error().code);
+            CHECK(whole.error().message == streamed.error().message);
+        }
+    }
+}
+
+TEST_CASE("PixelConvert: every SIMD level matches the scalar RGB->RGBA expansion") {
+    // 端数処理（16 / 18 画素境界の前後）を全部通す
+    for (std::size_t pixels : { 0, 1, 15, 16, 17, 18, 19, 33, 34, 35, 100, 1027 }) {
+        INFO(pixels);
+        std::vector<std::uint8_t> src(pixels * 3);
+        for (std::size_t i = 0; i < src.size(); ++i) src[i] = static_cast<std::uint8_t>(i * 37 + 11);
+
+        std::vector<std::uint8_t> expect(pixels * 4 + 8, 0xCD);
+        Detail::Rgb24ToRgba32(src.data(), expect.data(), pixels, Detail::SimdLevel::Scalar);
+        for (std::size_t i = 0; i < pixels; ++i) {
+            CHECK(expect[i * 4 + 0] == src[i * 3 + 0]);
+            CHECK(expect[i * 4 + 3] == 255);
+        }
+
+        for (auto level : { Detail::SimdLevel::Ssse3, Detail::SimdLevel::Avx2 }) {
+            std::vector<std::uint8_t> got(pixels * 4 + 8, 0xCD);
+            Detail::Rgb24ToRgba32(src.data(), got.data(), pixels, level);
+            CHECK(got == expect); // 末尾の番兵も書き換えない
+        }
+    }
+}
+
+TEST_CASE("PcmConvert: 16-bit byte swap and little-endian PCM decode") {
+    // 奇数アドレスの入力
+    for (std::size_t samples : { 0, 1, 7, 8, 9, 1001 }) {
+        INFO(samples);
+        std::vector<std::uint8_t> raw(samples * 2 + 1);
+        for (std::size_t i = 0; i < raw.size(); ++i) raw[i] = static_cast<std::uint8_t>(i * 59 + 3);
+        const std::uint8_t* src = raw.data() + 1;
+
+        std::vector<std::int16_t> expect(samples + 4, 0x5A5A);
+        for (std::size_t i = 0; i < samples; ++i) {
+            expect[i] = static_cast<std::int16_t>(static_cast<std::uint16_t>((src[i * 2] << 8) | src[i * 2 + 1]));
+        }
+
+        std::vector<std::int16_t> got(samples + 4, 0x5A5A);
+        Detail::ByteSwap16(src, got.data(), samples);
+        CHECK(got == expect); // 末尾の番兵も書き換えない
+
+        // SoundStreamLoader は読み込んだ ring の上で in-place に入れ替える
+        std::vector<std::int16_t> inPlace(samples);
+        if (samples > 0) std::memcpy(inPlace.data(), src, samples * 2);
+        Detail::ByteSwap16(reinterpret_cast<const std::uint8_t*>(inPlace.data()), inPlace.data(), samples);
+        CHECK(std::equal(inPlace.begin(), inPlace.end(), expect.begin()));
+
+        std::vector<std::int16_t> native(samples);
+        Detail::Pcm16LeToNative(src, native.data(), samples);
+        for (std::size_t i = 0; i < samples; ++i) {
+            CHECK(native[i] == static_cast<std::int16_t>(static_cast<std::uint16_t>(src[i * 2] | (src[i * 2 + 1] << 8))));
+        }
+    }
+}
+
+TEST_CASE("SoundLoader: mapped source aliases PCM16 samples instead of copying") {
+    fs::path tmp = fs::temp_directory_path() / "asset_loader_test_sound_alias";
+    fs::remove_all(tmp);
+    const std::string wav = MakeWav(2, 777);
+    WriteBytes(tmp / "a.wav", wav);
+
+    // 増分 decode は常に所有コピー
+    PipelineFixture f;
+    auto copied = f.Load(tmp / "a.wav", "sound", 4096);
+    REQUIRE(copied);
+    const auto* sc = copied.value().As<Loaders::SoundAsset>();
+    REQUIRE(sc != nullptr);
+    CHECK(!sc->keepAlive);
+    const auto expect = sc->Samples();
+    REQUIRE(expect.size() == 777);
+
+    auto same = [&](Detail::ConstSpan<std::int16_t> got) {
+        return got.size() == expect.size() && std::equal(got.begin(), got.end(), expect.begin());
+    };
+
+    // mmap source は増分 decode より LoadView を選ぶ
+    Sources::MappedFileAssetSource mapped;
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::SoundLoader>());
+    Loading::AssetPipeline pipeline{ mapped, registry };
+
+    Loading::LoadContext ctx;
+    ctx.id = AssetId::FromString("a.wav");
+    ctx.type = AssetType::FromString("sound");
+    ctx.resolvedPath = (tmp / "a.wav").string();
+    auto aliased = pipeline.Load(ctx);
+    REQUIRE(aliased);
+    const auto* sa = aliased.value().As<Loaders::SoundAsset>();
+    REQUIRE(sa != nullptr);
+    CHECK(sa->channels == 2);
+    CHECK(sa->sampleRate == 44100);
+    if constexpr (std::endian::native == std::endian::little) {
+        CHECK(sa->keepAlive != nullptr);
+        CHECK(sa->pcm16.empty());
+    }
+    CHECK(same(sa->Samples()));
+
+    // owner 無し / 奇数アドレス / aliasSourceBytes=false はコピーに落ちる
+    auto oddBuf = std::make_shared<std::vector<std::byte>>(wav.size() + 1);
+    std::memcpy(oddBuf->data() + 1, wav.data(), wav.size());
+    auto evenBuf = std::make_shared<std::vector<std::byte>>(wav.size());
+    std::memcpy(evenBuf->data(), wav.data(), wav.size());
+
+    Loading::SourceView odd;
+    odd.bytes = Detail::ConstSpan<std::byte>{ oddBuf->data() + 1, wav.size() };
+    odd.owner = oddBuf;
+    Loading::SourceView unowned;
+    unowned.bytes = Detail::ConstSpan<std::byte>{ evenBuf->data(), wav.size() };
+    Loading::SourceView even = unowned;
+    even.owner = evenBuf;
+
+    Loaders::SoundLoader loader;
+    Loaders::SoundLoader::Options noAlias;
+    noAlias.aliasSourceBytes = false;
+    Loaders::SoundLoader copyLoader{ noAlias };
+
+    for (auto r : { loader.LoadView(odd, ctx), loader.LoadView(unowned, ctx), copyLoader.LoadView(even, ctx) }) {
+        REQUIRE(r);
+        const auto* s = r.value().As<Loaders::SoundAsset>();
+        REQUIRE(s != nullptr);
+        CHECK(!s->keepAlive);
+        CHECK(same(s->Samples()));
+    }
+}
+
+namespace {
+    // OpenRange の回数を数える（reader が refill ごとに開き直していないかを見る）
+    struct RangeCountingSource final : Sources::FileAssetSource {
+        int rangeOpens = 0;
+
+        Engine::Base::Result<std::unique_ptr<Loading::IRangeReader>, Loading::AssetError>
+        OpenRange(std::string_view resolvedPath) override {
+            ++rangeOpens;
+            return FileAssetSource::OpenRange(resolvedPath);
+        }
+    };
+}
+
+TEST_CASE("SoundStreamLoader: reads only the header and streams PCM through a small ring") {
+    fs::path tmp = fs::temp_directory_path() / "asset_loader_test_sound_stream";
+    fs::remove_all(tmp);
+    const std::uint32_t kSamples = 20000;
+    WriteBytes(tmp / "bgm.wav", MakeWav(2, kSamples));
+
+    PipelineFixture f;
+    auto full = f.Load(tmp / "bgm.wav", "sound", 4096);
+    REQUIRE(full);
+    const auto expect = full.value().As<Loaders::SoundAsset>()->Samples();
+    REQUIRE(expect.size() == kSamples);
+
+    RangeCountingSource source;
+    Loading::LoaderRegistry registry;
+    Loaders::SoundStreamLoader::Options opt;
+    opt.ringSamples = 1000;
+    opt.readAheadSamples = 300;
+    registry.Register(std::make_unique<Loaders::SoundStreamLoader>(source, opt));
+    Loading::AssetPipeline pipeline{ source, registry };
+    Loading::AssetPipeline::Options popt;
+    popt.streamChunkBytes = 16;
+    pipeline.SetOptions(popt);
+
+    Loading::LoadContext ctx;
+    ctx.id = AssetId::FromString("bgm.wav");
+    ctx.type = AssetType::FromString("sound_stream");
+    ctx.resolvedPath = (tmp / "bgm.wav").string();
+    Loading::LoadReport report;
+    auto r = pipeline.Load(ctx, &report);
+    REQUIRE(r);
+    CHECK(report.bytesRead < 128); // data の本体は読んでいない
+
+    const auto* snd = r.value().As<Loaders::StreamingSoundAsset>();
+    REQUIRE(snd != nullptr);
+    CHECK(snd->channels == 2);
+    CHECK(snd->sampleRate == 44100);
+    CHECK(snd->totalSamples == kSamples);
+
+    Loaders::SoundStreamReader reader(*snd);
+    CHECK(reader.Capacity() == 1000);
+    REQUIRE(reader.Prefetch());
+    CHECK(reader.Buffered() == 1000);
+
+    // 半端な長さで読んでもリングの巻き戻りを跨いで同じ列になる
+    std::vector<std::int16_t> got;
+    std::vector<std::int16_t> buf(337);
+    for (;;) {
+        auto n = reader.Read(Detail::Span<std::int16_t>{ buf.data(), buf.size() });
+        REQUIRE(n);
+        if (n.value() == 0) break;
+        CHECK(reader.Buffered() <= reader.Capacity());
+        got.insert(got.end(), buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(n.value()));
+    }
+    CHECK(reader.AtEnd());
+    REQUIRE(got.size() == kSamples);
+    CHECK(std::equal(got.begin(), got.end(), expect.begin()));
+
+    reader.Seek(12345);
+    auto n = reader.Read(Detail::Span<std::int16_t>{ buf.data(), 10 });
+    REQUIRE(n);
+    REQUIRE(n.value() == 10);
+    CHECK(std::equal(buf.begin(), buf.begin() + 10, expect.begin() + 12345));
+
+    reader.Seek(kSamples + 5);
+    CHECK(reader.AtEnd());
+    auto end = reader.Read(Detail::Span<std::int16_t>{ buf.data(), buf.size() });
+    REQUIRE(end);
+    CHECK(end.value() == 0);
+
+    // 何十回 refill / Seek しても開くのは 1 回だけ
+    CHECK(source.rangeOpens == 1);
+}
+
+TEST_CASE("SoundStreamLoader: header errors match SoundLoader") {
+    fs::path tmp = fs::temp_directory_path() / "asset_loader_test_sound_stream_err";
+    fs::remove_all(tmp);
+
+    std::string cutWav = MakeWav(1, 100);
+    cutWav.resize(cutWav.size() - 20);
+    WriteBytes(tmp / "cut.wav", cutWav);
+    WriteBytes(tmp / "three.wav", MakeWav(3, 10));
+    WriteBytes(tmp / "tiny.wav", "RIFF");
+    WriteBytes(tmp / "text.wav", "hello, this is not a wav file");
+
+    Sources::FileAssetSource source;
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::SoundLoader>());
+    registry.Register(std::make_unique<Loaders::SoundStreamLoader>(source));
+    Loading::AssetPipeline pipeline{ source, registry };
+
+    for (const char* name : { "cut.wav", "three.wav", "tiny.wav", "text.wav" }) {
+        INFO(name);
+        Loading::LoadContext ctx;
+        ctx.id = AssetId::FromString(name);
+        ctx.resolvedPath = (tmp / name).string();
+        ctx.type = AssetType::FromString("sound");
+        auto whole = pipeline.Load(ctx);
+        ctx.type = AssetType::FromString("sound_stream");
+        auto streamed = pipeline.Load(ctx);
+        REQUIRE(!whole);
+        REQUIRE(!streamed);
+        CHECK(whole.error().code == streamed.error().code);
+        CHECK(whole.error().message == streamed.error().message);
+    }
+}
+
+TEST_CASE("AsciiScan: P3 fast path parses any spacing and declines what it cannot handle") {
+    const char* seps[] = { " ", "\n", "  \t", "\r\n", "\v\f " };
+    for (std::size_t pixels : { 1, 5, 21, 22, 100, 333 }) {
+        INFO(pixels);
+        std::string text;
+        std::vector<std::uint8_t> expect;
+        for (std::size_t i = 0; i < pixels * 3; ++i) {
+            const unsigned v = static_cast<unsigned>((i * 89 + 7) % 256);
+            // 先頭 0 付き（4 桁以上）も混ぜる
+            text += (i % 17 == 0) ? "00" + std::to_string(v) : std::to_string(v);
+            text += seps[i % 5];
+            expect.push_back(static_cast<std::uint8_t>(v));
+            if (i % 3 == 2) expect.push_back(255);
+        }
+
+        std::vector<std::uint8_t> got(pixels * 4);
+        const char* p = text.data();
+        REQUIRE(Detail::ParseAsciiRgbToRgba(p, text.data() + text.size(), got.data(), pixels));
+        CHECK(got == expect);
+    }
+
+    std::vector<std::uint8_t> out(4);
+    for (const char* bad : { "1 2 # c\n 3", "1 -2 3", "1 256 3", "1 2", "1 2 x" }) {
+        INFO(bad);
+        const std::string text = bad;
+        const char* p = text.data();
+        CHECK(!Detail::ParseAsciiRgbToRgba(p, text.data() + text.size(), out.data(), 1));
+    }
+}
+
+TEST_CASE("TextureLoader: P3 keeps comment/sign support and the original errors") {
+    fs::path tmp = fs::temp_directory_path() / "asset_loader_test_p3";
+    fs::remove_all(tmp);
+    WriteBytes(tmp / "comment.ppm", "P3\n2 1\n255\n1 2 3 # mid-body comment\n-0 5 255\n");
+    WriteBytes(tmp / "range.ppm", "P3\n1 1\n255\n1 256 3\n");
+    WriteBytes(tmp / "short.ppm", "P3\n2 1\n255\n1 2 3 4\n");
+
+    PipelineFixture f;
+
+    auto ok = f.Load(tmp / "comment.ppm", "texture", 0);
+    REQUIRE(ok);
+    const auto* t = ok.value().As<Loaders::TextureAsset>();
+    REQUIRE(t != nullptr);
+    const std::vector<std::uint8_t> expect{ 1, 2, 3, 255, 0, 5, 255, 255 };
+    CHECK(std::vector<std::uint8_t>(t->rgba.begin(), t->rgba.end()) == expect);
+
+    auto range = f.Load(tmp / "range.ppm", "texture", 0);
+    REQUIRE(!range);
+    CHECK(range.error().message == "PPM(P3): color out of range");
+
+    auto shortBody = f.Load(tmp / "short.ppm", "texture", 0);
+    REQUIRE(!shortBody);
+    CHECK(shortBody.error().message == "PPM(P3): body parse failed");
+}
+
+TEST_CASE("ResidentBytes: pipeline reports what the decoded asset keeps in memory") {
+    fs::path tmp = fs::temp_directory_path() / "asset_loader_test_resident";
+    fs::remove_all(tmp);
+    WriteBytes(tmp / "a.ppm", MakeP6(13, 7));
+    WriteBytes(tmp / "a.wav", MakeWav(2, 1001));
+
+    PipelineFixture f;
+    auto load = [&](const char* file, const char* type, std::size_t chunkBytes, Loading::LoadReport& report) {
+        Loading::AssetPipeline::Options opt;
+        opt.streamChunkBytes = chunkBytes;
+        f.pipeline.SetOptions(opt);
+
+        Loading::LoadContext ctx;
+        ctx.id = AssetId::FromString(file);
+        ctx.type = AssetType::FromString(type);
+        ctx.resolvedPath = (tmp / file).string();
+        return f.pipeline.Load(ctx, &report);
+    };
+
+    for (std::size_t chunk : { std::size_t{ 0 }, std::size_t{ 64 } }) {
+        INFO(chunk);
+        Loading::LoadReport tr{};
+        auto t = load("a.ppm", "texture", chunk, tr);
+        REQUIRE(t);
+        const auto* tex = t.value().As<Loaders::TextureAsset>();
+        REQUIRE(tex != nullptr);
+        CHECK(tr.decodedBytes == sizeof(Loaders::TextureAsset) + tex->rgba.capacity());
+        CHECK(tr.decodedBytes >= 13u * 7u * 4u);
+
+        Loading::LoadReport sr{};
+        auto s = load("a.wav", "sound", chunk, sr);
+        REQUIRE(s);
+        CHECK(sr.decodedBytes >= sizeof(Loaders::SoundAsset) + 1001u * 2u);
+    }
+
+    // 型が違う asset には 0（不明）を返す
+    Loaders::TextureLoader texLoader;
+    CHECK(texLoader.ResidentBytes(Core::AnyAsset::MakeShared<int>(1)) == 0);
+}
@@ -1,5 +1,8 @@
 #include "doctest/doctest.h"
 
+#include <filesystem>
+#include <fstream>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -9,13 +12,17 @@
 #include "engine/asset/core/AssetStorage.hpp"
 #include "engine/asset/core/AssetLifetime.hpp"
 #include "engine/asset/core/AssetCachePolicy.hpp"
+#include "engine/asset/core/AssetStatistics.hpp"
 #include "engine/asset/loading/AssetPipeline.hpp"
 #include "engine/asset/loading/LoaderRegistry.hpp"
 #include "engine/asset/loading/IAssetSource.hpp"
 #include "engine/asset/loading/IAssetLoader.hpp"
+#include "engine/asset/loaders/BinaryLoader.hpp"
+#include "engine/asset/loaders/SoundStreamLoader.hpp"
 #include "engine/asset/loaders/TextLoader.hpp"
 #include "engine/asset/resolver/AssetPathResolver.hpp"
 #include "engine/asset/catalog/CatalogParser.hpp"
+#include "engine/asset/sources/FileAssetSource.hpp"
 
 
 using namespace Engine::Asset;
@@ -101,6 +108,13 @@ TEST_CASE("AssetManager: sync load -> cache hit") {
     auto h2 = mgr.Load(AssetId::FromString("ui.title"), req);
     REQUIRE(h2);
     CHECK(h2.value().generation() == h1.value().generation());
+
+    // handle は storage の slot を持ち、AssetId 無しでも同じ record に届く
+    CHECK(h1.value().has_slot());
+    CHECK(h2.value().slot() == h1.value().slot());
+    auto bySlot = AssetHandle::Make(AssetId{}, h1.value().generation(), h1.value().slot());
+    auto sp2 = mgr.GetShared<Loaders::TextAsset>(bySlot);
+    CHECK(sp2 == sp1);
 }
 
 TEST_CASE("AssetManager: reload increments generation and stale handle") {
@@ -120,3 +134,664 @@ TEST_CASE("AssetManager: reload fail + KeepOldIfAny keeps Ready") {
     // 3) fallback=KeepOldIfAny なら Ready のまま旧データ維持
     CHECK(true);
 }
+
+TEST_CASE("AssetManager: async load runs on worker threads and publishes in Update") {
+    AssetCatalog catalog;
+
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+
+    MemoryAssetSource memSource;
+    memSource.Put("mem://ui/a.txt", BytesOf("alpha"));
+    memSource.Put("mem://ui/b.txt", BytesOf("beta"));
+
+    Loading::AssetPipeline pipeline(memSource, registry);
+
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy policy(Core::AssetCachePolicy::Options{});
+
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+    AssetManager::Options opt;
+    opt.workerThreads = 2;
+    mgr.SetOptions(opt);
+
+    auto makeReq = [](const char* path) {
+        AssetRequest req = AssetRequest::AsyncLoad();
+        req.overridePath = path;
+        req.useTypeHint = true;
+        req.expectedType = AssetType::FromString("text");
+        return req;
+    };
+
+    auto ha = mgr.Load(AssetId::FromString("ui.a"), makeReq("mem://ui/a.txt"));
+    auto hb = mgr.Load(AssetId::FromString("ui.b"), makeReq("mem://ui/b.txt"));
+    REQUIRE(ha);
+    REQUIRE(hb);
+
+    // publish は Update（同期点）まで行われない
+    CHECK(mgr.GetState(ha.value()) == AssetState::Loading);
+
+    mgr.Update();               // worker へ投入
+    mgr.WaitForAsyncLoads();    // 完了待ち + publish
+
+    CHECK(mgr.GetState(ha.value()) == AssetState::Ready);
+    CHECK(mgr.GetState(hb.value()) == AssetState::Ready);
+
+    auto spa = mgr.GetShared<Loaders::TextAsset>(ha.value());
+    auto spb = mgr.GetShared<Loaders::TextAsset>(hb.value());
+    REQUIRE(spa != nullptr);
+    REQUIRE(spb != nullptr);
+    CHECK(spa->text == "alpha");
+    CHECK(spb->text == "beta");
+
+    // 読めないパスは Failed として publish される
+    auto hc = mgr.Load(AssetId::FromString("ui.c"), makeReq("mem://ui/missing.txt"));
+    REQUIRE(hc);
+    mgr.WaitForAsyncLoads();
+    CHECK(mgr.GetState(hc.value()) == AssetState::Failed);
+    REQUIRE(mgr.GetError(hc.value()) != nullptr);
+    CHECK(mgr.GetError(hc.value())->code == AssetErrorCode::SourceReadFailed);
+}
+
+TEST_CASE("AssetManager: async batches still read only the header of sound_stream assets") {
+    namespace fs = std::filesystem;
+    fs::path tmp = fs::temp_directory_path() / "asset_manager_async_stream";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+
+    // PCM16 mono の WAV（data 本体 64 KiB）+ テキスト 3 つ
+    const std::uint32_t kSamples = 32 * 1024;
+    std::string wav = "RIFF";
+    auto u16 = [&](std::uint16_t v) { wav.push_back(char(v & 0xFF)); wav.push_back(char(v >> 8)); };
+    auto u32 = [&](std::uint32_t v) { u16(std::uint16_t(v & 0xFFFF)); u16(std::uint16_t(v >> 16)); };
+    u32(0);
+    wav += "WAVEfmt ";
+    u32(16); u16(1); u16(1); u32(44100); u32(44100 * 2); u16(2); u16(16);
+    wav += "data";
+    u32(kSamples * 2);
+    wav.append(kSamples * 2, '\x01');
+    std::ofstream(tmp / "bgm.wav", std::ios::binary) << wav;
+    for (int i = 0; i < 3; ++i) {
+        std::ofstream(tmp / ("t" + std::to_string(i) + ".txt"), std::ios::binary) << "text";
+    }
+
+    AssetCatalog catalog;
+    Sources::FileAssetSource source;
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+    registry.Register(std::make_unique<Loaders::SoundStreamLoader>(source));
+    Loading::AssetPipeline::Options popt;
+    popt.streamChunkBytes = 64;
+    Loading::AssetPipeline pipeline(source, registry, popt);
+
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy policy(Core::AssetCachePolicy::Options{});
+    Core::AssetStatistics stats;
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, &stats, nullptr);
+
+    // worker 1 本：同じフレームに積んだ 4 件は 1 バッチ（LoadMany）で走る
+    AssetManager::Options opt;
+    opt.workerThreads = 1;
+    mgr.SetOptions(opt);
+
+    auto load = [&](const char* id, const fs::path& path, const char* type) {
+        AssetRequest req = AssetRequest::AsyncLoad();
+        req.overridePath = path.string();
+        req.useTypeHint = true;
+        req.expectedType = AssetType::FromString(type);
+        auto h = mgr.Load(AssetId::FromString(id), req);
+        REQUIRE(h);
+        return h.value();
+    };
+    std::vector<AssetHandle> hs;
+    hs.push_back(load("t0", tmp / "t0.txt", "text"));
+    hs.push_back(load("bgm", tmp / "bgm.wav", "sound_stream"));
+    hs.push_back(load("t1", tmp / "t1.txt", "text"));
+    hs.push_back(load("t2", tmp / "t2.txt", "text"));
+
+    mgr.Update();
+    mgr.WaitForAsyncLoads();
+    for (auto& h : hs) CHECK(mgr.GetState(h) == AssetState::Ready);
+
+    auto snd = mgr.GetShared<Loaders::StreamingSoundAsset>(hs[1]);
+    REQUIRE(snd != nullptr);
+    CHECK(snd->totalSamples == kSamples);
+
+    // WAV は data チャンクのヘッダまでしか読んでいない（本体 64 KiB は読まない）
+    const auto* bgm = stats.Find(AssetId::FromString("bgm"));
+    REQUIRE(bgm != nullptr);
+    CHECK(bgm->lastBytesRead > 0);
+    CHECK(bgm->lastBytesRead <= 128);
+    const auto* t1 = stats.Find(AssetId::FromString("t1"));
+    REQUIRE(t1 != nullptr);
+    CHECK(t1->lastBytesRead == 4);
+}
+
+TEST_CASE("AssetManager: frameBudgetUs bounds queue draining by time") {
+    AssetCatalog catalog;
+
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+
+    MemoryAssetSource memSource;
+    for (int i = 0; i < 4; ++i) {
+        memSource.Put("mem://t/" + std::to_string(i), BytesOf("x"));
+    }
+
+    Loading::AssetPipeline pipeline(memSource, registry);
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy policy(Core::AssetCachePolicy::Options{});
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+
+    auto loadAll = [&](const char* prefix) {
+        std::vector<AssetHandle> hs;
+        for (int i = 0; i < 4; ++i) {
+            AssetRequest req = AssetRequest::AsyncLoad();
+            req.overridePath = "mem://t/" + std::to_string(i);
+            req.useTypeHint = true;
+            req.expectedType = AssetType::FromString("text");
+            auto h = mgr.Load(AssetId::FromString(std::string(prefix) + std::to_string(i)), req);
+            REQUIRE(h);
+            hs.push_back(h.value());
+        }
+        return hs;
+    };
+    auto countReady = [&](const std::vector<AssetHandle>& hs) {
+        int n = 0;
+        for (auto& h : hs) n += (mgr.GetState(h) == AssetState::Ready) ? 1 : 0;
+        return n;
+    };
+
+    // 極小予算：見積もりが予算を超えるので 1フレーム1件（最低保証）だけ進む
+    AssetManager::Options opt;
+    opt.maxLoadsPerFrame = 100;
+    opt.frameBudgetUs = 1;
+    mgr.SetOptions(opt);
+
+    auto small = loadAll("small.");
+    mgr.Update();
+    CHECK(countReady(small) == 1);
+    mgr.Update();
+    CHECK(countReady(small) == 2);
+
+    // 十分な予算：件数制限（maxLoadsPerFrame=1）に関係なく一度に消化する
+    opt.maxLoadsPerFrame = 1;
+    opt.frameBudgetUs = 1'000'000;
+    mgr.SetOptions(opt);
+
+    auto big = loadAll("big.");
+    mgr.Update();
+    CHECK(countReady(small) == 4);
+    CHECK(countReady(big) == 4);
+    CHECK(mgr.GetCostModel().Samples() == 8);
+}
+
+TEST_CASE("AssetManager: incremental catalog reload reloads only changed entries") {
+    namespace fs = std::filesystem;
+    fs::path tmp = fs::temp_directory_path() / "asset_manager_catalog_reload";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+    const fs::path catalogPath = tmp / "asset_catalog.json";
+    auto writeCatalog = [&](const std::string& text) {
+        std::ofstream ofs(catalogPath.string(), std::ios::binary);
+        ofs << text;
+    };
+
+    Resolver::AssetPathResolver::Options ropt;
+    ropt.assetsRoot = "mem";
+    Resolver::AssetPathResolver resolver(ropt);
+    Catalog::CatalogParser parser;
+    AssetCatalog catalog;
+
+    writeCatalog(R"({"assets":[
+      {"id":"ui.a","type":"text","path":"ui/a.txt"},
+      {"id":"ui.b","type":"text","path":"ui/b.txt"},
+      {"id":"ui.c","type":"text","path":"ui/c.txt"}
+    ]})");
+    REQUIRE(catalog.LoadFromFile(catalogPath.string(), parser, resolver));
+    const auto* entryB = catalog.Find(AssetId::FromString("ui.b"));
+    REQUIRE(entryB != nullptr);
+
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+
+    MemoryAssetSource memSource;
+    memSource.Put("mem/ui/a.txt", BytesOf("alpha"));
+    memSource.Put("mem/ui/a2.txt", BytesOf("alpha2"));
+    memSource.Put("mem/ui/b.txt", BytesOf("beta"));
+
+    Loading::AssetPipeline pipeline(memSource, registry);
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy policy(Core::AssetCachePolicy::Options{});
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+
+    AssetRequest req = AssetRequest::Default();
+    req.sync = AssetRequest::SyncWith::Sync;
+    auto ha = mgr.Load(AssetId::FromString("ui.a"), req);
+    auto hb = mgr.Load(AssetId::FromString("ui.b"), req);
+    REQUIRE(ha);
+    REQUIRE(hb);
+    auto spb = mgr.GetShared<Loaders::TextAsset>(hb.value());
+    REQUIRE(spb != nullptr);
+
+    // a は path 変更、b は書き方だけ変更、c は削除、d は追加
+    writeCatalog(R"({"assets":{
+      "ui.a": {"type":"text","path":"ui/a2.txt"},
+      "ui.b": {"type":"text","path":"ui/./b.txt"},
+      "ui.d": {"type":"text","path":"ui/d.txt"}
+    }})");
+    auto diff = catalog.ReloadFromFile(catalogPath.string(), parser, resolver);
+    REQUIRE(diff);
+    REQUIRE(diff.value().changed.size() == 1);
+    CHECK(diff.value().changed[0] == AssetId::FromString("ui.a"));
+    REQUIRE(diff.value().added.size() == 1);
+    CHECK(diff.value().added[0] == AssetId::FromString("ui.d"));
+    REQUIRE(diff.value().removed.size() == 1);
+    CHECK(diff.value().removed[0] == AssetId::FromString("ui.c"));
+
+    // 変わらなかった entry はそのまま（ポインタも有効）
+    CHECK(catalog.Find(AssetId::FromString("ui.b")) == entryB);
+    CHECK(entryB->sourcePath == "ui/./b.txt");
+    CHECK(catalog.Find(AssetId::FromString("ui.c")) == nullptr);
+
+    CHECK(mgr.ApplyCatalogDiff(diff.value()) == 1);
+    mgr.Update();
+
+    // a だけ新しい path で読み直される（generation++ で旧 handle は stale）
+    CHECK(mgr.GetShared<Loaders::TextAsset>(ha.value()) == nullptr);
+    auto ha2 = mgr.Load(AssetId::FromString("ui.a"), req);
+    REQUIRE(ha2);
+    auto spa = mgr.GetShared<Loaders::TextAsset>(ha2.value());
+    REQUIRE(spa != nullptr);
+    CHECK(spa->text == "alpha2");
+    CHECK(mgr.GetShared<Loaders::TextAsset>(hb.value()) == spb);
+
+    // 壊れた catalog：失敗して今の内容は残る
+    writeCatalog(R"({"assets":[ {"id":"ui.a","type":"text"} ]})");
+    CHECK(!catalog.ReloadFromFile(catalogPath.string(), parser, resolver));
+    CHECK(catalog.Size() == 3);
+    CHECK(catalog.Find(AssetId::FromString("ui.a"))->resolvedPath == "mem/ui/a2.txt");
+}
+
+TEST_CASE("AssetManager: Budgeted trims least recently released assets in Update") {
+    namespace fs = std::filesystem;
+    fs::path tmp = fs::temp_directory_path() / "asset_manager_budget_trim";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+    const fs::path catalogPath = tmp / "asset_catalog.json";
+    {
+        std::ofstream ofs(catalogPath.string(), std::ios::binary);
+        ofs << R"({"assets":[
+          {"id":"t.a","type":"text","path":"a.txt"},
+          {"id":"t.b","type":"text","path":"b.txt"},
+          {"id":"t.c","type":"text","path":"c.txt"},
+          {"id":"t.d","type":"text","path":"d.txt"},
+          {"id":"t.e","type":"text","path":"e.txt"}
+        ]})";
+    }
+
+    Resolver::AssetPathResolver::Options ropt;
+    ropt.assetsRoot = "mem";
+    Resolver::AssetPathResolver resolver(ropt);
+    Catalog::CatalogParser parser;
+    AssetCatalog catalog;
+    REQUIRE(catalog.LoadFromFile(catalogPath.string(), parser, resolver));
+
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+
+    MemoryAssetSource memSource;
+    for (const char* n : {"a", "b", "c", "d", "e"}) {
+        memSource.Put(std::string("mem/") + n + ".txt", BytesOf(n));
+    }
+
+    Loading::AssetPipeline pipeline(memSource, registry);
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy::Options popt;
+    popt.mode = Core::AssetCachePolicy::Mode::Budgeted;
+    popt.maxAssets = 3;
+    Core::AssetCachePolicy policy(popt);
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+
+    AssetRequest req = AssetRequest::Default();
+    req.sync = AssetRequest::SyncWith::Sync;
+    std::unordered_map<std::string, AssetHandle> h;
+    for (const char* n : {"a", "b", "c", "d", "e"}) {
+        auto r = mgr.Load(AssetId::FromString(std::string("t.") + n), req);
+        REQUIRE(r);
+        h[n] = r.value();
+    }
+    CHECK(storage.Size() == 5);
+
+    // 解放順：a, b, c。その後 b を使い直すので、古い順は a, c, b
+    mgr.BeginFrame(1);
+    mgr.Release(h["a"]);
+    mgr.Release(h["b"]);
+    mgr.Release(h["c"]);
+    mgr.BeginFrame(2);
+    REQUIRE(mgr.Acquire(h["b"]));
+    mgr.Release(h["b"]);
+    CHECK(lifetime.UnreferencedCount() == 3);
+
+    mgr.Update();
+
+    // 5 -> 3：参照の無いうちの古い 2 つだけ消える
+    CHECK(storage.Size() == 3);
+    CHECK(mgr.GetState(h["a"]) == AssetState::Unloaded);
+    CHECK(mgr.GetState(h["c"]) == AssetState::Unloaded);
+    CHECK(mgr.GetState(h["b"]) == AssetState::Ready);
+    CHECK(mgr.GetState(h["d"]) == AssetState::Ready);
+    CHECK(mgr.GetState(h["e"]) == AssetState::Ready);
+    CHECK(lifetime.UnreferencedCount() == 1);
+
+    // 参照中の asset しか無ければ、上限を超えていても消さない
+    auto ra = mgr.Load(AssetId::FromString("t.a"), req);
+    REQUIRE(ra);
+    mgr.Update();
+    CHECK(storage.Size() == 3); // b が消えて a が入る
+    CHECK(mgr.GetState(h["b"]) == AssetState::Unloaded);
+
+    auto rc = mgr.Load(AssetId::FromString("t.c"), req);
+    REQUIRE(rc);
+    mgr.Update();
+    CHECK(storage.Size() == 4);
+    CHECK(lifetime.UnreferencedCount() == 0);
+
+    // TTL が切れていなければ消さない
+    popt.keepAliveFrames = 10;
+    policy.SetOptions(popt);
+    mgr.Release(rc.value());
+    mgr.Update();
+    CHECK(storage.Size() == 4);
+    mgr.BeginFrame(20);
+    mgr.Update();
+    CHECK(storage.Size() == 3);
+    CHECK(mgr.GetState(rc.value()) == AssetState::Unloaded);
+}
+
+TEST_CASE("AssetManager: Budgeted enforces per-type resident byte budgets") {
+    namespace fs = std::filesystem;
+    fs::path tmp = fs::temp_directory_path() / "asset_manager_byte_budget";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+    const fs::path catalogPath = tmp / "asset_catalog.json";
+    {
+        std::ofstream ofs(catalogPath.string(), std::ios::binary);
+        ofs << R"({"assets":[
+          {"id":"t.a","type":"text","path":"a.txt"},
+          {"id":"t.b","type":"text","path":"b.txt"},
+          {"id":"t.c","type":"text","path":"c.txt"},
+          {"id":"t.s","type":"text","path":"s.txt"}
+        ]})";
+    }
+
+    Resolver::AssetPathResolver::Options ropt;
+    ropt.assetsRoot = "mem";
+    Resolver::AssetPathResolver resolver(ropt);
+    Catalog::CatalogParser parser;
+    AssetCatalog catalog;
+    REQUIRE(catalog.LoadFromFile(catalogPath.string(), parser, resolver));
+
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+
+    MemoryAssetSource memSource;
+    memSource.Put("mem/a.txt", BytesOf(std::string(1000, 'a')));
+    memSource.Put("mem/b.txt", BytesOf(std::string(1000, 'b')));
+    memSource.Put("mem/c.txt", BytesOf(std::string(1000, 'c')));
+    memSource.Put("mem/s.txt", BytesOf("s"));
+
+    Loading::AssetPipeline pipeline(memSource, registry);
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy::Options popt;
+    popt.mode = Core::AssetCachePolicy::Mode::Budgeted;
+    Core::AssetCachePolicy policy(popt);
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+
+    AssetRequest req = AssetRequest::Default();
+    req.sync = AssetRequest::SyncWith::Sync;
+    std::unordered_map<std::string, AssetHandle> h;
+    for (const char* n : {"s", "a", "b", "c"}) {
+        auto r = mgr.Load(AssetId::FromString(std::string("t.") + n), req);
+        REQUIRE(r);
+        h[n] = r.value();
+    }
+
+    // 1000 文字の text は heap の分まで数える。短い文字列は SSO に収まるので本体だけ
+    const std::uint64_t small = storage.Find(AssetId::FromString("t.s"))->residentBytes;
+    const std::uint64_t large = storage.Find(AssetId::FromString("t.a"))->residentBytes;
+    CHECK(small == sizeof(Loaders::TextAsset));
+    CHECK(large >= sizeof(Loaders::TextAsset) + 1000);
+    CHECK(mgr.GetResidentBytes() == small + 3 * large);
+    CHECK(mgr.GetResidentBytes(AssetType::Text()) == small + 3 * large);
+
+    // 上限なし：何も消えない
+    for (const char* n : {"a", "b", "c", "s"}) mgr.Release(h[n]);
+    mgr.Update();
+    CHECK(storage.Size() == 4);
+
+    // text を大きいもの 2 個分 + s に絞る：はみ出しは 1 個分なので、いちばん古い a だけ消す
+    popt.maxResidentBytesPerType[AssetType::Text()] = 2 * large + small;
+    policy.SetOptions(popt);
+    mgr.Update();
+    CHECK(storage.Size() == 3);
+    CHECK(mgr.GetState(h["s"]) == AssetState::Ready);
+    CHECK(mgr.GetState(h["a"]) == AssetState::Unloaded);
+    CHECK(mgr.GetResidentBytes(AssetType::Text()) == small + 2 * large);
+
+    // 合計の上限：1 個分まで
+    popt.maxResidentBytesPerType.clear();
+    popt.maxBytesRead = large + small;
+    policy.SetOptions(popt);
+    mgr.Update();
+    CHECK(storage.Size() == 2);
+    CHECK(mgr.GetState(h["b"]) == AssetState::Unloaded);
+    CHECK(mgr.GetState(h["c"]) == AssetState::Ready);
+    CHECK(mgr.GetResidentBytes() == small + large);
+
+    // evict で集計から抜ける
+    CHECK(mgr.EvictIfPossible(AssetId::FromString("t.c")));
+    CHECK(mgr.GetResidentBytes() == small);
+}
+
+TEST_CASE("AssetManager: Budgeted trims with the configured eviction algorithm and records traces") {
+    namespace fs = std::filesystem;
+    fs::path tmp = fs::temp_directory_path() / "asset_manager_eviction_algo";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+    const fs::path catalogPath = tmp / "asset_catalog.json";
+    {
+        std::ofstream ofs(catalogPath.string(), std::ios::binary);
+        ofs << R"({"assets":[
+          {"id":"t.a","type":"text","path":"a.txt"},
+          {"id":"t.b","type":"text","path":"b.txt"},
+          {"id":"t.c","type":"text","path":"c.txt"}
+        ]})";
+    }
+
+    Resolver::AssetPathResolver::Options ropt;
+    ropt.assetsRoot = "mem";
+    Resolver::AssetPathResolver resolver(ropt);
+    Catalog::CatalogParser parser;
+    AssetCatalog catalog;
+    REQUIRE(catalog.LoadFromFile(catalogPath.string(), parser, resolver));
+
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+
+    MemoryAssetSource memSource;
+    for (const char* n : {"a", "b", "c"}) {
+        memSource.Put(std::string("mem/") + n + ".txt", BytesOf(n));
+    }
+
+    Loading::AssetPipeline pipeline(memSource, registry);
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy::Options popt;
+    popt.mode = Core::AssetCachePolicy::Mode::Budgeted;
+    popt.maxAssets = 2;
+    popt.eviction = Core::EvictionAlgorithm::Lfu;
+    Core::AssetCachePolicy policy(popt);
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+
+    std::vector<Core::EvictionTraceEvent> trace;
+    mgr.SetAccessTrace(&trace);
+
+    AssetRequest req = AssetRequest::Default();
+    req.sync = AssetRequest::SyncWith::Sync;
+    auto load = [&](const char* n) {
+        auto r = mgr.Load(AssetId::FromString(std::string("t.") + n), req);
+        REQUIRE(r);
+        return r.value();
+    };
+
+    // a は 3 回、c は 2 回、b は 1 回使う
+    const AssetHandle ha = load("a");
+    const AssetHandle hb = load("b");
+    const AssetHandle hc = load("c");
+    mgr.Release(load("a"));
+    mgr.Release(load("a"));
+    mgr.Release(load("c"));
+
+    // 参照が切れた順は a, b, c（LRU なら a が消える）
+    mgr.Release(ha);
+    mgr.Release(hb);
+    mgr.Release(hc);
+    mgr.Update();
+
+    CHECK(storage.Size() == 2);
+    CHECK(mgr.GetState(hb) == AssetState::Unloaded);
+    CHECK(mgr.GetState(ha) == AssetState::Ready);
+    CHECK(mgr.GetState(hc) == AssetState::Ready);
+
+    // ロード 3 件 + ヒット 3 件
+    REQUIRE(trace.size() == 6);
+    CHECK(trace[0].id == AssetId::FromString("t.a"));
+    CHECK(trace[0].bytes == sizeof(Loaders::TextAsset));
+    CHECK(trace[0].reloadCost == 1);
+    CHECK(trace[3].id == AssetId::FromString("t.a"));
+
+    // 記録はそのまま simulator に流せる
+    Core::EvictionSimulator::Options sopt;
+    sopt.capacityCount = 2;
+    const auto ranked = Core::EvictionSimulator(sopt).Compare(trace);
+    CHECK(ranked.size() == 4);
+}
+
+TEST_CASE("AssetManager: deferDestruction moves evicted assets to the graveyard") {
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+
+    MemoryAssetSource memSource;
+    memSource.Put("mem/big.txt", BytesOf(std::string(4096, 'x')));
+
+    AssetCatalog catalog;
+    Loading::AssetPipeline pipeline(memSource, registry);
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy policy(Core::AssetCachePolicy::Options{});
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+
+    AssetManager::Options opt;
+    opt.deferDestruction = true;
+    mgr.SetOptions(opt);
+    REQUIRE(mgr.GetGraveyard() != nullptr);
+
+    AssetRequest req = AssetRequest::Default();
+    req.sync = AssetRequest::SyncWith::Sync;
+    req.overridePath = "mem/big.txt";
+    req.useTypeHint = true;
+    req.expectedType = AssetType::Text();
+    const AssetId id = AssetId::FromString("big");
+    auto h = mgr.Load(id, req);
+    REQUIRE(h);
+
+    // 呼び出し側が持っている shared_ptr は graveyard を通っても生きている
+    auto held = mgr.GetShared<Loaders::TextAsset>(h.value());
+    REQUIRE(held != nullptr);
+
+    mgr.Release(h.value());
+    REQUIRE(mgr.EvictIfPossible(id));
+    CHECK(mgr.GetResidentBytes() == 0);
+
+    mgr.BeginFrame(1);
+    mgr.GetGraveyard()->Flush();
+    CHECK(mgr.GetGraveyard()->GetCounters().buried == 1);
+    CHECK(held->text.size() == 4096);
+
+    // 無効にすると graveyard は止まる
+    opt.deferDestruction = false;
+    mgr.SetOptions(opt);
+    CHECK(mgr.GetGraveyard() == nullptr);
+}
+
+TEST_CASE("AssetManager: keepAlive per type and per request") {
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::TextLoader>());
+    registry.Register(std::make_unique<Loaders::BinaryLoader>());
+
+    MemoryAssetSource memSource;
+    memSource.Put("mem/big.txt", BytesOf(std::string(4096, 'x')));
+    memSource.Put("mem/ui.bin", BytesOf("click"));
+    memSource.Put("mem/keep.txt", BytesOf("keep"));
+
+    AssetCatalog catalog;
+    Loading::AssetPipeline pipeline(memSource, registry);
+    Core::AssetStorage storage;
+    Core::AssetLifetime lifetime;
+    Core::AssetCachePolicy::Options popt;
+    popt.mode = Core::AssetCachePolicy::Mode::Budgeted;
+    popt.maxAssets = 1;
+    popt.keepAliveFrames = 0;
+    popt.keepAliveFramesPerType[AssetType::Binary()] = 100; // UI 音などは長めに残す
+    Core::AssetCachePolicy policy(popt);
+    AssetManager mgr(catalog, pipeline, storage, lifetime, policy, nullptr, nullptr);
+
+    CHECK(policy.KeepAliveFramesFor(AssetType::Binary()) == 100);
+    CHECK(policy.KeepAliveFramesFor(AssetType::Text()) == 0);
+
+    auto load = [&](const char* id, const char* path, AssetType type, std::uint64_t keepAlive) {
+        AssetRequest req = AssetRequest::Default();
+        req.sync = AssetRequest::SyncWith::Sync;
+        req.overridePath = path;
+        req.useTypeHint = true;
+        req.expectedType = type;
+        req.keepAliveFramesOverride = keepAlive;
+        auto r = mgr.Load(AssetId::FromString(id), req);
+        REQUIRE(r);
+        return r.value();
+    };
+
+    mgr.BeginFrame(1);
+    const AssetHandle ui = load("ui", "mem/ui.bin", AssetType::Binary(), 0);
+    const AssetHandle big = load("big", "mem/big.txt", AssetType::Text(), 0);
+    const AssetHandle keep = load("keep", "mem/keep.txt", AssetType::Text(), 50);
+    CHECK(lifetime.GetKeepAliveOverride(keep.id()) == 50);
+    CHECK(lifetime.KeepAliveOverrideCount() == 1);
+
+    // 先に解放された ui（TTL 100）を飛ばして、TTL 0 の big を回収する
+    mgr.Release(ui);
+    mgr.Release(big);
+    mgr.Release(keep);
+    mgr.Update();
+    CHECK(mgr.GetState(big) == AssetState::Unloaded);
+    CHECK(mgr.GetState(ui) == AssetState::Ready);
+    CHECK(mgr.GetState(keep) == AssetState::Ready);
+
+    // 要求ごとの TTL（50）が先に切れる
+    mgr.BeginFrame(60);
+    mgr.Update();
+    CHECK(mgr.GetState(keep) == AssetState::Unloaded);
+    CHECK(mgr.GetState(ui) == AssetState::Ready);
+    CHECK(lifetime.KeepAliveOverrideCount() == 0);
+
+    mgr.BeginFrame(200);
+    mgr.Update();
+    CHECK(storage.Size() == 1); // 上限 1 件までは残す
+}
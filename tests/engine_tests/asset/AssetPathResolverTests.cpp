@@ -1,5 +1,9 @@
 #include "doctest/doctest.h"
+#include <cctype>
 #include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "engine/asset/resolver/AssetPathResolver.hpp"
 
@@ -59,3 +63,173 @@ TEST_CASE("AssetPathResolver: reject escape root") {
 
 
 }
+
+namespace {
+
+    // 差分テスト用：一時文字列を作りながら段階的に解決していた以前の Resolve（結果の正解として使う）
+    struct ReferenceResult final {
+        bool ok = false;
+        std::string value;   // ok のとき
+        std::string message; // !ok のとき
+    };
+
+    bool RefIsSlash(char c) { return c == '/' || c == '\\'; }
+
+    std::string RefNormalize(std::string_view path, bool normalizeSeparators, bool squashSlashes) {
+        std::string out;
+        bool prevSlash = false;
+        for (char c : path) {
+            char x = c;
+            if (normalizeSeparators && x == '\\') x = '/';
+            const bool isSlash = (x == '/');
+            if (squashSlashes) {
+                if (isSlash) {
+                    if (prevSlash) continue;
+                    prevSlash = true;
+                } else {
+                    prevSlash = false;
+                }
+            }
+            out.push_back(x);
+        }
+        return out;
+    }
+
+    bool RefIsAbsolute(std::string_view p) {
+        if (p.empty()) return false;
+        if (p[0] == '/') return true;
+        if (p.size() >= 2 && RefIsSlash(p[0]) && RefIsSlash(p[1])) return true;
+        return p.size() >= 3 && std::isalpha(static_cast<unsigned char>(p[0])) && p[1] == ':' && RefIsSlash(p[2]);
+    }
+
+    std::string RefRemoveDotSegments(std::string_view p, bool& escaped) {
+        escaped = false;
+        std::string prefix;
+        if (p.size() >= 3 && std::isalpha(static_cast<unsigned char>(p[0])) && p[1] == ':' && p[2] == '/') {
+            prefix = std::string(p.substr(0, 3));
+            p.remove_prefix(3);
+        } else if (p.size() >= 2 && p[0] == '/' && p[1] == '/') {
+            prefix = "//";
+            p.remove_prefix(2);
+        } else if (!p.empty() && p[0] == '/') {
+            prefix = "/";
+            p.remove_prefix(1);
+        }
+
+        std::vector<std::string> stack;
+        std::size_t i = 0;
+        while (i <= p.size()) {
+            std::size_t j = p.find('/', i);
+            if (j == std::string_view::npos) j = p.size();
+            std::string_view seg = p.substr(i, j - i);
+            i = j + 1;
+            if (seg.empty() || seg == ".") continue;
+            if (seg == "..") {
+                if (!stack.empty()) stack.pop_back();
+                else escaped = true;
+                continue;
+            }
+            stack.emplace_back(seg);
+        }
+
+        std::string out = prefix;
+        for (const auto& s : stack) {
+            if (!out.empty() && out.back() != '/') out.push_back('/');
+            out += s;
+        }
+        return out;
+    }
+
+    ReferenceResult RefResolve(const AssetPathResolver::Options& opt, std::string_view path) {
+        if (path.empty()) return { false, {}, "AssetPathResolver: empty path" };
+
+        std::string p(path);
+        if (opt.allowSchemes) {
+            auto pos = path.find("://");
+            if (pos != std::string_view::npos) {
+                std::string_view rest = path.substr(pos + 3);
+                while (!rest.empty() && RefIsSlash(rest.front())) rest.remove_prefix(1);
+                p = std::string(rest);
+            }
+        }
+        p = RefNormalize(p, opt.normalizeSeparators, opt.squashSlashes);
+
+        bool escaped = false;
+        if (RefIsAbsolute(p)) {
+            if (!opt.allowAbsolutePath) return { false, {}, "AssetPathResolver: absolute path is not allowed" };
+            return { true, RefRemoveDotSegments(p, escaped), {} };
+        }
+
+        std::string joined = opt.assetsRoot.empty() ? "assets" : opt.assetsRoot;
+        for (auto& c : joined) {
+            if (c == '\\') c = '/';
+        }
+        if (joined.back() != '/') joined.push_back('/');
+        std::string_view rel = p;
+        while (!rel.empty() && RefIsSlash(rel.front())) rel.remove_prefix(1);
+        joined.append(rel);
+        joined = RefNormalize(joined, opt.normalizeSeparators, opt.squashSlashes);
+
+        std::string cleaned = RefRemoveDotSegments(joined, escaped);
+        if (escaped && !opt.allowEscapeAssetsRoot) {
+            return { false, {}, "AssetPathResolver: path escapes assetsRoot via '..' which is not allowed" };
+        }
+        return { true, std::move(cleaned), {} };
+    }
+
+} // namespace
+
+TEST_CASE("AssetPathResolver: single-pass resolve matches the staged reference") {
+    const std::vector<std::string> roots = {
+        "assets", "assets/", "", "/abs/root", "C:\\game\\assets", "a//b\\", "./x/../y", "//unc/share",
+    };
+    const std::vector<std::string> paths = {
+        "textures/a.ppm", "res://textures/a.ppm", "assets:///\\x.txt", "a//b///c", "a\\b\\c.txt",
+        "./a/./b/.", "a/../b", "../outside.txt", "a/../../b", "../../../../../../x", "/etc/passwd",
+        "\\\\server\\share\\f", "C:/x/../y", "C:\\x", "c:", "C:", "//", "/", ".", "..", "res://",
+        "res://../x", "x/", "x//", "...", "a/.../b", "\\x", "a:/b", "1:/b", "a://b://c", " ", "a\\..\\b",
+    };
+
+    int checked = 0;
+    for (int bits = 0; bits < 32; ++bits) {
+        for (const auto& root : roots) {
+            AssetPathResolver::Options opt;
+            opt.assetsRoot = root;
+            opt.allowAbsolutePath = (bits & 1) != 0;
+            opt.allowEscapeAssetsRoot = (bits & 2) != 0;
+            opt.normalizeSeparators = (bits & 4) != 0;
+            opt.squashSlashes = (bits & 8) != 0;
+            opt.allowSchemes = (bits & 16) != 0;
+            AssetPathResolver r(opt);
+
+            std::string arena = "prefix|";
+            for (const auto& path : paths) {
+                INFO("root = " << root << ", path = " << path << ", bits = " << bits);
+                const ReferenceResult expected = RefResolve(opt, path);
+
+                auto got = r.Resolve(path);
+                REQUIRE(got.ok() == expected.ok);
+                if (expected.ok) {
+                    CHECK(got.value() == expected.value);
+                } else {
+                    CHECK(got.error().code == Engine::Asset::AssetErrorCode::InvalidPath);
+                    CHECK(got.error().message == expected.message);
+                }
+
+                // ResolveAppend：追記した部分だけが結果、失敗時は arena を戻す
+                const std::size_t before = arena.size();
+                auto appended = r.ResolveAppend(path, arena);
+                REQUIRE(appended.ok() == expected.ok);
+                if (expected.ok) {
+                    CHECK(appended.value() == expected.value);
+                    CHECK(arena.size() == before + expected.value.size());
+                } else {
+                    CHECK(arena.size() == before);
+                }
+                ++checked;
+            }
+            CHECK(arena.compare(0, 7, "prefix|") == 0);
+        }
+    }
+    CHECK(checked == static_cast<int>(32 * roots.size() * paths.size()));
+}
@@ -0,0 +1,396 @@
+#include "doctest/doctest.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/AssetType.hpp"
+#include "engine/asset/loaders/BinaryLoader.hpp"
+#include "engine/asset/loading/AssetPipeline.hpp"
+#include "engine/asset/loading/LoaderRegistry.hpp"
+#include "engine/asset/pak/PakBuilder.hpp"
+#include "engine/asset/pak/PakCompression.hpp"
+#include "engine/asset/sources/BatchFileAssetSource.hpp"
+#include "engine/asset/sources/MappedFileAssetSource.hpp"
+#include "engine/asset/sources/PakAssetSource.hpp"
+
+namespace fs = std::filesystem;
+using namespace Engine::Asset;
+
+static void WriteBytes(const fs::path& p, const std::string& s) {
+    fs::create_directories(p.parent_path());
+    std::ofstream ofs(p.string(), std::ios::binary);
+    ofs << s;
+}
+
+static std::string ToString(Detail::ConstSpan<std::byte> b) {
+    return std::string(reinterpret_cast<const char*>(b.data()), b.size());
+}
+
+TEST_CASE("MappedFileAssetSource: ReadView maps file and ReadAll copies") {
+    fs::path tmp = fs::temp_directory_path() / "asset_source_test_mmap";
+    fs::remove_all(tmp);
+    WriteBytes(tmp / "a.bin", "mapped-bytes");
+    WriteBytes(tmp / "empty.bin", "");
+
+    Sources::MappedFileAssetSource src;
+
+    auto v = src.ReadView((tmp / "a.bin").string());
+    REQUIRE(v);
+    CHECK(v.value().owner != nullptr);
+    CHECK(ToString(v.value().bytes) == "mapped-bytes");
+
+    auto all = src.ReadAll((tmp / "a.bin").string());
+    REQUIRE(all);
+    CHECK(all.value().size() == 12);
+
+    auto e = src.ReadView((tmp / "empty.bin").string());
+    REQUIRE(e);
+    CHECK(e.value().bytes.empty());
+
+    auto missing = src.ReadView((tmp / "missing.bin").string());
+    REQUIRE(!missing);
+    CHECK(missing.error().code == AssetErrorCode::SourceNotFound);
+}
+
+TEST_CASE("MappedFileAssetSource: BinaryLoader keeps the mapping instead of copying") {
+    fs::path tmp = fs::temp_directory_path() / "asset_source_test_blob";
+    fs::remove_all(tmp);
+    WriteBytes(tmp / "blob.bin", "0123456789");
+
+    Sources::MappedFileAssetSource src;
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::BinaryLoader>());
+    Loading::AssetPipeline pipeline(src, registry);
+
+    Loading::LoadContext ctx;
+    ctx.id = AssetId::FromString("blob");
+    ctx.type = AssetType::FromString("binary");
+    ctx.resolvedPath = (tmp / "blob.bin").string();
+
+    Loading::LoadReport report{};
+    auto r = pipeline.Load(ctx, &report);
+    REQUIRE(r);
+    CHECK(report.bytesRead == 10);
+
+    auto bin = r.value().ShareAs<Loaders::BinaryAsset>();
+    REQUIRE(bin != nullptr);
+    CHECK(bin->data.IsBorrowed());      // mapping を保持（所有コピーは作らない）
+    CHECK(bin->data.OwnedCapacity() == 0);
+    CHECK(ToString(bin->Bytes()) == "0123456789");
+}
+
+TEST_CASE("BinaryLoader: Bytes() returns the data for owned and borrowed blobs alike") {
+    fs::path tmp = fs::temp_directory_path() / "asset_source_test_blob_file";
+    fs::remove_all(tmp);
+    WriteBytes(tmp / "blob.bin", "abcdef");
+
+    // 普通のファイル source でも既定の ReadView が owner を付けるので借用になる
+    Sources::FileAssetSource src;
+    Loading::LoaderRegistry registry;
+    registry.Register(std::make_unique<Loaders::BinaryLoader>());
+    Loading::AssetPipeline pipeline(src, registry);
+
+    Loading::LoadContext ctx;
+    ctx.id = AssetId::FromString("blob");
+    ctx.type = AssetType::FromString("binary");
+    ctx.resolvedPath = (tmp / "blob.bin").string();
+    auto r = pipeline.Load(ctx);
+    REQUIRE(r);
+    auto bin = r.value().ShareAs<Loaders::BinaryAsset>();
+    REQUIRE(bin != nullptr);
+    CHECK(ToString(bin->Bytes()) == "abcdef");
+
+    // 所有コピーはコピー / ムーブしても自分のバッファを指す
+    Loaders::BinaryAsset owned;
+    const std::string text = "owned";
+    owned.data = Detail::ByteBlob::Copy(Detail::ConstSpan<std::byte>{ reinterpret_cast<const std::byte*>(text.data()), text.size() });
+    CHECK(!owned.data.IsBorrowed());
+    Loaders::BinaryAsset copy = owned;
+    CHECK(copy.Bytes().data() != owned.Bytes().data());
+    CHECK(ToString(copy.Bytes()) == "owned");
+    Loaders::BinaryAsset moved = std::move(owned);
+    CHECK(ToString(moved.Bytes()) == "owned");
+}
+
+static Detail::ConstSpan<std::byte> SpanOf(const std::string& s) {
+    return Detail::ConstSpan<std::byte>{ reinterpret_cast<const std::byte*>(s.data()), s.size() };
+}
+
+TEST_CASE("PakCompression: round trip and rejects corrupted input") {
+    std::string text;
+    for (int i = 0; i < 200; ++i) text += "tile " + std::to_string(i % 7) + ";";
+
+    auto packed = Pak::CompressLz(SpanOf(text));
+    REQUIRE(!packed.empty());
+    CHECK(packed.size() < text.size());
+
+    std::string out(text.size(), '\0');
+    auto ok = Pak::DecompressLz(Detail::ConstSpan<std::byte>{ packed.data(), packed.size() },
+                                Detail::Span<std::byte>{ reinterpret_cast<std::byte*>(out.data()), out.size() });
+    REQUIRE(ok);
+    CHECK(out == text);
+
+    // 縮まない入力は空（無圧縮で格納させる）
+    CHECK(Pak::CompressLz(SpanOf("abc")).empty());
+
+    // 出力サイズが合わない / 途中で切れている
+    std::string small(text.size() - 1, '\0');
+    CHECK(!Pak::DecompressLz(Detail::ConstSpan<std::byte>{ packed.data(), packed.size() },
+                             Detail::Span<std::byte>{ reinterpret_cast<std::byte*>(small.data()), small.size() }));
+    CHECK(!Pak::DecompressLz(Detail::ConstSpan<std::byte>{ packed.data(), packed.size() / 2 },
+                             Detail::Span<std::byte>{ reinterpret_cast<std::byte*>(out.data()), out.size() }));
+}
+
+TEST_CASE("PakAssetSource: lookup by path or id, aligned and compressed entries") {
+    fs::path tmp = fs::temp_directory_path() / "asset_source_test_pak";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+
+    std::string big;
+    for (int i = 0; i < 500; ++i) big += "0123456789abcdef";
+
+    Pak::PakBuilder::Options opt;
+    opt.alignment = 64;
+    Pak::PakBuilder builder(opt);
+    REQUIRE(builder.Add(AssetId::FromString("a"), "assets/a.txt", SpanOf("hello")));
+    REQUIRE(builder.Add(AssetId::FromString("big"), "assets/big.bin", SpanOf(big), Pak::Compression::Lz));
+    REQUIRE(builder.Add(AssetId::FromString("empty"), "assets/empty.bin", SpanOf("")));
+
+    // 二重登録は弾く
+    CHECK(!builder.Add(AssetId::FromString("a"), "assets/other.txt", SpanOf("x")));
+    CHECK(!builder.Add(AssetId::FromString("other"), "assets/a.txt", SpanOf("x")));
+
+    const std::string pakPath = (tmp / "data.pak").string();
+    REQUIRE(builder.WriteToFile(pakPath));
+    CHECK(fs::file_size(pakPath) < big.size()); // big は圧縮されている
+
+    Sources::PakAssetSource pak;
+    REQUIRE(pak.Open(pakPath));
+    CHECK(pak.EntryCount() == 3);
+
+    auto a = pak.ReadAll("assets/a.txt");
+    REQUIRE(a);
+    CHECK(std::string(reinterpret_cast<const char*>(a.value().data()), a.value().size()) == "hello");
+
+    // Windows 区切りでも同じエントリ
+    CHECK(pak.Exists("assets\\a.txt"));
+
+    auto b = pak.ReadById(AssetId::FromString("big"));
+    REQUIRE(b);
+    CHECK(std::string(reinterpret_cast<const char*>(b.value().data()), b.value().size()) == big);
+
+    auto e = pak.ReadAll("assets/empty.bin");
+    REQUIRE(e);
+    CHECK(e.value().empty());
+
+    // 部分読み：無圧縮は pread、圧縮は展開後から切り出す。終端は短く返る
+    std::vector<std::byte> part(8);
+    auto ra = pak.ReadRange("assets/a.txt", 1, Detail::Span<std::byte>{ part.data(), part.size() });
+    REQUIRE(ra);
+    CHECK(ToString(Detail::ConstSpan<std::byte>{ part.data(), ra.value() }) == "ello");
+    auto rb = pak.ReadRange("assets/big.bin", 1000, Detail::Span<std::byte>{ part.data(), part.size() });
+    REQUIRE(rb);
+    CHECK(ToString(Detail::ConstSpan<std::byte>{ part.data(), rb.value() }) == big.substr(1000, 8));
+    auto rc = pak.ReadRange("assets/a.txt", 99, Detail::Span<std::byte>{ part.data(), part.size() });
+    REQUIRE(rc);
+    CHECK(rc.value() == 0);
+
+    // OpenRange：圧縮エントリは開く時に 1 回だけ展開し、以後は切り出すだけ
+    auto hb = pak.OpenRange("assets/big.bin");
+    REQUIRE(hb);
+    for (std::uint64_t off : { 0ull, 4000ull, 7996ull }) {
+        auto n = hb.value()->ReadAt(off, Detail::Span<std::byte>{ part.data(), part.size() });
+        REQUIRE(n);
+        CHECK(ToString(Detail::ConstSpan<std::byte>{ part.data(), n.value() }) == big.substr(off, 8));
+    }
+    auto ha = pak.OpenRange("assets/a.txt");
+    REQUIRE(ha);
+    auto na = ha.value()->ReadAt(2, Detail::Span<std::byte>{ part.data(), part.size() });
+    REQUIRE(na);
+    CHECK(ToString(Detail::ConstSpan<std::byte>{ part.data(), na.value() }) == "llo");
+    CHECK(!pak.OpenRange("assets/nope.txt"));
+
+    CHECK(pak.Contains(AssetId::FromString("empty")));
+    CHECK(!pak.Contains(AssetId::FromString("nope")));
+
+    auto missing = pak.ReadAll("assets/nope.txt");
+    REQUIRE(!missing);
+    CHECK(missing.error().code == AssetErrorCode::SourceNotFound);
+
+    // pak 以外は UnsupportedFormat
+    WriteBytes(tmp / "not_a_pak.bin", std::string(128, 'x'));
+    Sources::PakAssetSource bad;
+    auto r = bad.Open((tmp / "not_a_pak.bin").string());
+    REQUIRE(!r);
+    CHECK(r.error().code == AssetErrorCode::UnsupportedFormat);
+}
+
+// 手書きの pak：data を Header の直後に置き、TOC に entries / slots をそのまま書く（PakBuilder を通さない）
+static void WriteRawPak(const fs::path& path, const std::vector<Pak::Entry>& entries,
+                        const std::vector<Pak::Slot>& slots, const std::string& data) {
+    Pak::Header h;
+    h.entryCount = static_cast<std::uint32_t>(entries.size());
+    h.slotCount = static_cast<std::uint32_t>(slots.size());
+    h.alignment = 1;
+    h.tocOffset = (Pak::kHeaderSize + data.size() + 7) & ~std::uint64_t{ 7 };
+    h.tocSize = entries.size() * Pak::kEntrySize + slots.size() * Pak::kSlotSize;
+
+    std::vector<std::byte> file(static_cast<std::size_t>(h.tocOffset + h.tocSize), std::byte{ 0 });
+    Pak::WriteHeader(file.data(), h);
+    if (!data.empty()) std::memcpy(file.data() + Pak::kHeaderSize, data.data(), data.size());
+    std::byte* p = file.data() + h.tocOffset;
+    for (const auto& e : entries) { Pak::WriteEntry(p, e); p += Pak::kEntrySize; }
+    for (const auto& sl : slots) { Pak::WriteSlot(p, sl); p += Pak::kSlotSize; }
+    WriteBytes(path, std::string(reinterpret_cast<const char*>(file.data()), file.size()));
+}
+
+TEST_CASE("PakAssetSource: an id equal to another entry's path resolves by key kind") {
+    fs::path tmp = fs::temp_directory_path() / "asset_source_test_pak_keys";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+
+    // PakBuilder は種類をまたいだ一致を弾く（同じエントリの id == path は可）
+    {
+        Pak::PakBuilder builder;
+        REQUIRE(builder.Add(AssetId::FromString("shared"), "assets/x.txt", SpanOf("x")));
+        auto r = builder.Add(AssetId::FromString("y"), "shared", SpanOf("y"));
+        REQUIRE(!r);
+        CHECK(r.error().code == AssetErrorCode::InvalidCatalogEntry);
+        CHECK(!builder.Add(AssetId::FromString("assets/x.txt"), "assets/z.txt", SpanOf("z")));
+        CHECK(builder.Add(AssetId::FromString("same"), "same", SpanOf("s")));
+    }
+
+    // 他の書き手が作った pak でも取り違えない：
+    // entry0 = (id "shared", path "assets/x.txt")、entry1 = (id "y", path "shared") を直接書く
+    const std::string data0 = "entry0";
+    const std::string data1 = "entry1";
+
+    std::vector<Pak::Entry> entries(2);
+    entries[0].idKey = AssetId::FromString("shared").value;
+    entries[0].pathKey = Pak::PathKey("assets/x.txt");
+    entries[0].offset = Pak::kHeaderSize;
+    entries[0].storedSize = entries[0].rawSize = data0.size();
+    entries[1].idKey = AssetId::FromString("y").value;
+    entries[1].pathKey = Pak::PathKey("shared");
+    entries[1].offset = Pak::kHeaderSize + data0.size();
+    entries[1].storedSize = entries[1].rawSize = data1.size();
+    REQUIRE(entries[0].idKey == entries[1].pathKey);
+
+    std::vector<Pak::Slot> slots(16);
+    const std::uint32_t mask = static_cast<std::uint32_t>(slots.size() - 1);
+    for (std::uint32_t e = 0; e < 2; ++e) {
+        for (std::uint64_t key : { entries[e].idKey, entries[e].pathKey }) {
+            std::uint32_t i = Pak::SlotOf(key, mask);
+            while (slots[i].entryIndex != Pak::kEmptySlot) i = (i + 1) & mask;
+            slots[i].key = key;
+            slots[i].entryIndex = e;
+        }
+    }
+
+    WriteRawPak(tmp / "keys.pak", entries, slots, data0 + data1);
+
+    Sources::PakAssetSource pak;
+    REQUIRE(pak.Open((tmp / "keys.pak").string()));
+
+    auto byId = pak.ReadById(AssetId::FromString("shared"));
+    REQUIRE(byId);
+    CHECK(ToString(Detail::ConstSpan<std::byte>{ byId.value().data(), byId.value().size() }) == "entry0");
+
+    auto byPath = pak.ReadAll("shared");
+    REQUIRE(byPath);
+    CHECK(ToString(Detail::ConstSpan<std::byte>{ byPath.value().data(), byPath.value().size() }) == "entry1");
+
+    // path しか持たないキー / id しか持たないキーは逆側では見つからない
+    CHECK(!pak.Contains(AssetId(Pak::PathKey("assets/x.txt"))));
+    CHECK(!pak.Exists("y"));
+}
+
+TEST_CASE("PakAssetSource: Open rejects a slot table without room to stop probing") {
+    fs::path tmp = fs::temp_directory_path() / "asset_source_test_pak_full";
+    fs::remove_all(tmp);
+    fs::create_directories(tmp);
+
+    std::vector<Pak::Entry> entries(1);
+    entries[0].idKey = AssetId::FromString("a").value;
+    entries[0].pathKey = Pak::PathKey("assets/a.txt");
+    entries[0].offset = Pak::kHeaderSize;
+    entries[0].storedSize = entries[0].rawSize = 1;
+
+    // 全スロットが埋まっている（無いキーを引くと探索が止まらない）
+    std::vector<Pak::Slot> full(4);
+    for (std::size_t i = 0; i < full.size(); ++i) {
+        full[i].key = i % 2 ? entries[0].pathKey : entries[0].idKey;
+        full[i].entryIndex = 0;
+    }
+    WriteRawPak(tmp / "full.pak", entries, full, "a");
+    Sources::PakAssetSource pak;
+    auto r = pak.Open((tmp / "full.pak").string());
+    REQUIRE(!r);
+    CHECK(r.error().code == AssetErrorCode::UnsupportedFormat);
+
+    // エントリ数 * 4 より小さい表も弾く（1 エントリ 2 キーで負荷率 0.5 を越える）
+    std::vector<Pak::Slot> small(2);
+    small[0].key = entries[0].idKey;
+    small[0].entryIndex = 0;
+    WriteRawPak(tmp / "small.pak", entries, small, "a");
+    CHECK(!pak.Open((tmp / "small.pak").string()));
+
+    // 空きが 1 つあれば開けて、無いキーの探索も止まる
+    full[3].entryIndex = Pak::kEmptySlot;
+    WriteRawPak(tmp / "one_free.pak", entries, full, "a");
+    REQUIRE(pak.Open((tmp / "one_free.pak").string()));
+    CHECK(!pak.Exists("assets/nope.txt"));
+    CHECK(!pak.Contains(AssetId::FromString("nope")));
+}
+
+static void CheckReadMany(Sources::BatchFileAssetSource& src, const fs::path& dir) {
+    std::vector<std::string> files;
+    for (int i = 0; i < 40; ++i) {
+        const fs::path p = dir / ("f" + std::to_string(i) + ".bin");
+        WriteBytes(p, std::string(static_cast<std::size_t>(i) * 1000, static_cast<char>('a' + i % 26)));
+        files.push_back(p.string());
+    }
+    files.push_back((dir / "missing.bin").string());
+
+    std::vector<std::string_view> paths(files.begin(), files.end());
+    std::vector<int> seen(paths.size(), 0);
+    std::vector<std::string> got(paths.size());
+    std::vector<AssetErrorCode> codes(paths.size(), AssetErrorCode::None);
+
+    src.ReadMany(Detail::ConstSpan<std::string_view>{ paths.data(), paths.size() },
+        [&](std::size_t i, Engine::Base::Result<Loading::SourceView, Loading::AssetError>&& r) {
+            ++seen[i];
+            if (r) got[i] = ToString(r.value().bytes);
+            else codes[i] = r.error().code;
+        });
+
+    for (std::size_t i = 0; i < 40; ++i) {
+        INFO(i);
+        CHECK(seen[i] == 1);
+        CHECK(got[i] == std::string(i * 1000, static_cast<char>('a' + i % 26)));
+    }
+    CHECK(seen[40] == 1);
+    CHECK(codes[40] == AssetErrorCode::SourceNotFound);
+}
+
+TEST_CASE("BatchFileAssetSource: ReadMany completes every path once (io_uring and pread pool)") {
+    fs::path tmp = fs::temp_directory_path() / "asset_source_test_batch";
+    fs::remove_all(tmp);
+
+    Sources::BatchFileAssetSource::Options opt;
+    opt.queueDepth = 8; // 40 件 > depth：投げ直しの経路も通す
+
+    Sources::BatchFileAssetSource uring(opt); // io_uring が無い環境では pread pool になる
+    CheckReadMany(uring, tmp);
+
+    opt.disableUring = true;
+    Sources::BatchFileAssetSource pool(opt);
+    CHECK(pool.GetBackend() == Sources::BatchFileAssetSource::Backend::ThreadPool);
+    CheckReadMany(pool, tmp);
+}
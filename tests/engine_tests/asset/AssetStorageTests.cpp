@@ -0,0 +1,270 @@
+#include "doctest/doctest.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/AssetType.hpp"
+#include "engine/asset/core/AssetGraveyard.hpp"
+#include "engine/asset/core/AssetStorage.hpp"
+
+using namespace Engine::Asset;
+
+static AssetId IdOf(int i) {
+    return AssetId::FromString("asset_" + std::to_string(i));
+}
+
+TEST_CASE("AssetStorage: records keep their address across growth and erase") {
+    Core::AssetStorage storage;
+    const AssetType type = AssetType::FromString("text");
+
+    std::vector<Core::AssetRecord*> addrs;
+    for (int i = 0; i < 2000; ++i) {
+        addrs.push_back(storage.GetOrCreate(IdOf(i), type, "p" + std::to_string(i)));
+    }
+    CHECK(storage.Size() == 2000);
+
+    // 表が何度作り直されても同じ record を指す。既存なら path は上書きしない
+    for (int i = 0; i < 2000; ++i) {
+        CHECK(storage.Find(IdOf(i)) == addrs[i]);
+        CHECK(storage.GetOrCreate(IdOf(i), type, "other") == addrs[i]);
+        CHECK(addrs[i]->resolvedPath == "p" + std::to_string(i));
+    }
+
+    // refCount があるものは force 無しでは消えない
+    storage.AddRef(IdOf(1));
+    storage.EraseIf(IdOf(1));
+    CHECK(storage.Contains(IdOf(1)));
+    storage.ReleaseRef(IdOf(1));
+    storage.ReleaseRef(IdOf(1)); // 0 未満にはならない
+    CHECK(addrs[1]->refCount == 0);
+    CHECK(storage.CanEvict(IdOf(1)));
+
+    for (int i = 0; i < 2000; i += 2) storage.EraseIf(IdOf(i));
+    CHECK(storage.Size() == 1000);
+    CHECK(!storage.Contains(IdOf(0)));
+    CHECK(storage.Find(IdOf(3)) == addrs[3]);
+
+    // 消した record は同期点まで解放されない
+    CHECK(storage.RetiredCount() == 1000);
+    CHECK(addrs[0]->id == IdOf(0));
+    CHECK(storage.ReclaimRetired() == 1000);
+    CHECK(storage.RetiredCount() == 0);
+
+    // Tombstone を踏んでも再登録できる
+    auto& again = *storage.GetOrCreate(IdOf(0), type);
+    CHECK(storage.Find(IdOf(0)) == &again);
+    CHECK(storage.Size() == 1001);
+
+    storage.Clear();
+    CHECK(storage.Size() == 0);
+    CHECK(!storage.Contains(IdOf(3)));
+}
+
+TEST_CASE("AssetStorage: concurrent GetOrCreate / Find / EraseIf agree on one record per id") {
+    Core::AssetStorage storage;
+    const AssetType type = AssetType::FromString("text");
+    constexpr int kIds = 4000;
+    constexpr int kThreads = 8;
+
+    std::vector<AssetId> ids;
+    for (int i = 0; i < kIds; ++i) ids.push_back(IdOf(i));
+
+    // 全スレッドが同じ id 群を作り合う：id ごとに 1 つの record に収束する
+    std::vector<std::vector<Core::AssetRecord*>> seen(kThreads, std::vector<Core::AssetRecord*>(kIds));
+    std::atomic<bool> go{ false };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            while (!go.load()) std::this_thread::yield();
+            for (int k = 0; k < kIds; ++k) {
+                const int i = (k * 7 + t * 131) % kIds;
+                seen[t][i] = storage.GetOrCreate(ids[i], type);
+                storage.AddRef(ids[i]);
+            }
+        });
+    }
+    go = true;
+    for (auto& th : threads) th.join();
+    threads.clear();
+
+    CHECK(storage.Size() == kIds);
+    for (int i = 0; i < kIds; ++i) {
+        for (int t = 1; t < kThreads; ++t) CHECK(seen[t][i] == seen[0][i]);
+        CHECK(seen[0][i]->refCount == kThreads);
+    }
+
+    // 読み手が回っている間に半分を消して、別の id を足す
+    std::atomic<bool> stop{ false };
+    std::atomic<int> misses{ 0 };
+    for (int t = 0; t < kThreads - 1; ++t) {
+        threads.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 1; i < kIds; i += 2) {
+                    const auto* r = storage.Find(ids[i]);
+                    if (!r || !(r->id == ids[i])) misses.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int i = 0; i < kIds; i += 2) storage.EraseIf(ids[i], true);
+    for (int i = kIds; i < kIds * 2; ++i) storage.GetOrCreate(IdOf(i), type);
+    stop = true;
+    for (auto& th : threads) th.join();
+
+    CHECK(misses.load() == 0); // 消していない id は常に見える
+    CHECK(storage.Size() == kIds / 2 + kIds);
+    CHECK(storage.ReclaimRetired() == kIds / 2);
+}
+
+TEST_CASE("AssetStorage: Resolve by slot + generation and stale detection across slot reuse") {
+    Core::AssetStorage storage;
+    const AssetType type = AssetType::FromString("text");
+
+    auto& a = *storage.GetOrCreate(IdOf(1), type);
+    auto& b = *storage.GetOrCreate(IdOf(2), type);
+    CHECK(a.slot != b.slot);
+    CHECK(storage.SlotCount() == 2);
+    CHECK(storage.Resolve(a.slot, a.generation) == &a);
+    CHECK(storage.Resolve(b.slot, b.generation) == &b);
+    CHECK(storage.Resolve(b.slot, b.generation + 1) == nullptr);
+    CHECK(storage.Resolve(12345, 1) == nullptr);
+
+    // 消した時点で古い (slot, generation) は引けない
+    const std::uint32_t slot = a.slot;
+    const std::uint32_t gen = a.generation;
+    storage.EraseIf(IdOf(1), true);
+    CHECK(storage.Resolve(slot, gen) == nullptr);
+
+    // 同期点までは slot を再利用しない
+    auto& c = *storage.GetOrCreate(IdOf(3), type);
+    CHECK(c.slot != slot);
+    CHECK(storage.ReclaimRetired() == 1);
+
+    // 再利用された slot は前より大きい世代から始まる
+    auto& d = *storage.GetOrCreate(IdOf(4), type);
+    CHECK(d.slot == slot);
+    CHECK(&d == &a);
+    CHECK(d.generation > gen);
+    CHECK(d.id == IdOf(4));
+    CHECK(d.refCount == 0);
+    CHECK(storage.Resolve(slot, gen) == nullptr);
+    CHECK(storage.Resolve(slot, d.generation) == &d);
+    CHECK(storage.SlotCount() == 3);
+
+    // Clear 後はすべて stale
+    const std::uint32_t dGen = d.generation;
+    const std::uint32_t bSlot = b.slot;
+    const std::uint32_t bGen = b.generation;
+    storage.Clear();
+    CHECK(storage.Resolve(slot, dGen) == nullptr);
+    CHECK(storage.Resolve(bSlot, bGen) == nullptr);
+}
+
+TEST_CASE("AssetStorage: GetOrCreate reports the record limit until retired slots are reclaimed") {
+    Core::AssetStorage storage(Core::AssetStorage::Options{ 200 });
+    const AssetType type = AssetType::FromString("text");
+    const int cap = static_cast<int>(storage.MaxSlots());
+    REQUIRE(cap == 256); // chunk 単位に切り上げ
+
+    for (int i = 0; i < cap; ++i) REQUIRE(storage.GetOrCreate(IdOf(i), type) != nullptr);
+    CHECK(storage.GetOrCreate(IdOf(cap), type) == nullptr);
+    CHECK(!storage.Contains(IdOf(cap)));
+
+    // 既存の id は上限でも引ける
+    CHECK(storage.GetOrCreate(IdOf(0), type) == storage.Find(IdOf(0)));
+
+    // 消しても同期点までは slot が埋まったまま
+    storage.EraseIf(IdOf(0), true);
+    CHECK(storage.GetOrCreate(IdOf(cap), type) == nullptr);
+
+    CHECK(storage.ReclaimRetired() == 1);
+    auto* rec = storage.GetOrCreate(IdOf(cap), type);
+    REQUIRE(rec != nullptr);
+    CHECK(rec->id == IdOf(cap));
+    CHECK(storage.SlotCount() == static_cast<std::uint32_t>(cap));
+}
+
+namespace {
+    // 破棄された thread を記録する asset
+    struct Tombstoned final {
+        std::mutex* mtx = nullptr;
+        std::vector<std::thread::id>* destroyedOn = nullptr;
+        ~Tombstoned() {
+            std::lock_guard<std::mutex> lock(*mtx);
+            destroyedOn->push_back(std::this_thread::get_id());
+        }
+    };
+} // namespace
+
+TEST_CASE("AssetStorage: ReclaimRetired hands assets to the graveyard, which destroys them off-thread") {
+    std::mutex mtx;
+    std::vector<std::thread::id> destroyedOn;
+    auto make = [&] {
+        auto p = std::make_shared<Tombstoned>();
+        p->mtx = &mtx;
+        p->destroyedOn = &destroyedOn;
+        return Core::AnyAsset::FromShared<Tombstoned>(std::move(p));
+    };
+
+    Core::AssetGraveyard::Options gopt;
+    gopt.batchSize = 2;
+    gopt.maxPendingBytes = 0;
+    Core::AssetGraveyard graveyard(gopt);
+
+    Core::AssetStorage storage;
+    const AssetType type = AssetType::FromString("texture");
+    for (int i = 0; i < 5; ++i) {
+        auto& rec = *storage.GetOrCreate(IdOf(i), type);
+        rec.SetReady(make());
+        rec.residentBytes = 100;
+        storage.EraseIf(IdOf(i), true);
+    }
+
+    CHECK(storage.ReclaimRetired(&graveyard) == 5);
+    graveyard.Flush();
+    CHECK(graveyard.PendingCount() == 0);
+    CHECK(graveyard.PendingBytes() == 0);
+    CHECK(graveyard.GetCounters().buried == 5);
+    CHECK(graveyard.GetCounters().destroyedInBackground == 5);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        REQUIRE(destroyedOn.size() == 5);
+        for (const auto& t : destroyedOn) CHECK(t != std::this_thread::get_id());
+    }
+
+    // graveyard なし：従来どおりその場で破棄
+    auto& rec = *storage.GetOrCreate(IdOf(100), type);
+    rec.SetReady(make());
+    storage.EraseIf(IdOf(100), true);
+    CHECK(storage.ReclaimRetired() == 1);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        REQUIRE(destroyedOn.size() == 6);
+        CHECK(destroyedOn.back() == std::this_thread::get_id());
+    }
+}
+
+TEST_CASE("AssetGraveyard: pending bytes above the threshold are destroyed by the caller") {
+    Core::AssetGraveyard::Options gopt;
+    gopt.maxPendingBytes = 250;
+    Core::AssetGraveyard graveyard(gopt);
+
+    // 100 + 100 + 100 > 250：background が片付けていなければ、いちばん古い分を Bury 側で破棄する
+    for (int i = 0; i < 3; ++i) graveyard.Bury(Core::AnyAsset::MakeShared<std::vector<char>>(100), 100);
+    CHECK(graveyard.PendingBytes() <= 250);
+
+    graveyard.Flush();
+    const auto c = graveyard.GetCounters();
+    CHECK(c.buried == 3);
+    CHECK(c.destroyedInBackground + c.destroyedInline == 3);
+    CHECK(graveyard.PendingBytes() == 0);
+
+    // 空の asset は預からない
+    graveyard.Bury(Core::AnyAsset{}, 100);
+    CHECK(graveyard.GetCounters().buried == 3);
+}
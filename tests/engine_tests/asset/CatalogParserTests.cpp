@@ -1,5 +1,7 @@
 #include "doctest/doctest.h"
 
+#include <string>
+
 #include "engine/asset/catalog/CatalogParser.hpp"
 
 using Engine::Asset::Catalog::CatalogParser;
@@ -36,3 +38,70 @@ TEST_CASE("CatalogParser: missing fields") {
     CHECK(!r);
     CHECK(r.error().code == Engine::Asset::AssetErrorCode::InvalidCatalogEntry);
 }
+
+TEST_CASE("CatalogParser: object-form assets") {
+    CatalogParser p;
+    const char* json = R"({
+      "version": 1,
+      "assets": {
+        "ui.title": {"type":"text","path":"ui/title.txt"},
+        "sfx.hit":  {"type":"sound","path":"audio/hit.wav","id":"ignored"}
+      }
+    })";
+
+    auto r = p.Parse(json, "mem://catalog.json");
+    REQUIRE(r);
+    REQUIRE(r.value().size() == 2);
+    CHECK(r.value()[0].id == "ui.title");
+    CHECK(r.value()[0].type == "text");
+    CHECK(r.value()[1].id == "sfx.hit");
+    CHECK(r.value()[1].path == "audio/hit.wav");
+}
+
+TEST_CASE("CatalogParser: views point into the source text") {
+    CatalogParser p;
+    const std::string json = R"({
+      "meta": {"tags":[1, 2.5e3, true, null, {"x":"y"}]},
+      "assets":[
+        {"id":"ui.title","type":"text","path":"ui/title.txt"},
+        42,
+        {"id":"esc\"aped","type":"text","path":"a\/bé.txt"}
+      ]
+    })";
+
+    auto r = p.ParseViews(json, "mem://catalog.json");
+    REQUIRE(r);
+    REQUIRE(r.value().size() == 2);
+
+    const auto& v = r.value()[0];
+    CHECK(v.id == "ui.title");
+    CHECK(v.id.data() >= json.data());
+    CHECK(v.id.data() < json.data() + json.size());
+
+    // エスケープ付きは復元した文字列を指す
+    CHECK(r.value()[1].id == "esc\"aped");
+    CHECK(r.value()[1].path == "a/b\xC3\xA9.txt");
+}
+
+TEST_CASE("CatalogParser: syntax errors win over schema errors") {
+    CatalogParser p;
+
+    // entry が欠けていても、後ろが壊れていれば ParseFailed
+    auto r = p.Parse(R"({ "assets":[ {"id":"a","type":"text"} ], )", "mem://catalog.json");
+    REQUIRE(!r);
+    CHECK(r.error().code == Engine::Asset::AssetErrorCode::ParseFailed);
+
+    auto trailing = p.Parse(R"({ "assets":[] } x)", "mem://catalog.json");
+    CHECK(!trailing);
+
+    auto notObject = p.Parse(R"([1, 2])", "mem://catalog.json");
+    REQUIRE(!notObject);
+    CHECK(notObject.error().code == Engine::Asset::AssetErrorCode::ParseFailed);
+}
+
+TEST_CASE("CatalogParser: unsupported version") {
+    CatalogParser p;
+    auto r = p.Parse(R"({ "version": 2, "assets":[] })", "mem://catalog.json");
+    REQUIRE(!r);
+    CHECK(r.error().code == Engine::Asset::AssetErrorCode::ParseFailed);
+}
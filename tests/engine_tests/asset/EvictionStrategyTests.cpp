@@ -0,0 +1,128 @@
+#include "doctest/doctest.h"
+
+#include <string>
+#include <vector>
+
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/core/EvictionSimulator.hpp"
+#include "engine/asset/core/EvictionStrategy.hpp"
+
+using namespace Engine::Asset;
+using Core::EvictionAlgorithm;
+
+static AssetId Id(const std::string& s) { return AssetId::FromString(s); }
+
+static std::vector<AssetId> Victims(const Core::IEvictionStrategy& s) {
+    std::vector<AssetId> out;
+    s.ForEachVictim([&](const AssetId& id) {
+        out.push_back(id);
+        return true;
+    });
+    return out;
+}
+
+TEST_CASE("EvictionStrategy: LRU and LFU order victims") {
+    auto lru = Core::MakeEvictionStrategy(EvictionAlgorithm::Lru);
+    auto lfu = Core::MakeEvictionStrategy(EvictionAlgorithm::Lfu);
+    for (auto* s : { lru.get(), lfu.get() }) {
+        s->OnInsert(Id("a"), 10, 10);
+        s->OnInsert(Id("b"), 10, 10);
+        s->OnInsert(Id("c"), 10, 10);
+        s->OnAccess(Id("a"));
+        s->OnAccess(Id("a"));
+        s->OnAccess(Id("c"));
+        s->OnAccess(Id("missing")); // 常駐していない id は無視
+        CHECK(s->Size() == 3);
+    }
+
+    // LRU：最後に使われたのが古い順
+    CHECK(Victims(*lru) == std::vector<AssetId>{ Id("b"), Id("a"), Id("c") });
+    // LFU：回数の少ない順（b=1, c=2, a=3）
+    CHECK(Victims(*lfu) == std::vector<AssetId>{ Id("b"), Id("c"), Id("a") });
+
+    lfu->OnRemove(Id("b"));
+    CHECK(!lfu->Contains(Id("b")));
+    CHECK(Victims(*lfu) == std::vector<AssetId>{ Id("c"), Id("a") });
+}
+
+TEST_CASE("EvictionStrategy: GDSF evicts large assets that are cheap to reload first") {
+    auto gdsf = Core::MakeEvictionStrategy(EvictionAlgorithm::Gdsf);
+
+    // 展開後 1 MiB だが source は 10 KiB のテクスチャと、source と同じ大きさのテキスト
+    gdsf->OnInsert(Id("tex"), 1024 * 1024, 10 * 1024);
+    gdsf->OnInsert(Id("txt"), 4 * 1024, 4 * 1024);
+    CHECK(Victims(*gdsf).front() == Id("tex"));
+
+    // 消すと L が上がり、後から入ったものほど残りやすくなる（aging）
+    gdsf->OnRemove(Id("tex"));
+    gdsf->OnInsert(Id("new"), 4 * 1024, 4 * 1024);
+    CHECK(Victims(*gdsf) == std::vector<AssetId>{ Id("txt"), Id("new") });
+}
+
+TEST_CASE("EvictionStrategy: ARC moves reused entries to T2 and adapts on ghost hits") {
+    auto arc = Core::MakeEvictionStrategy(EvictionAlgorithm::Arc, 4);
+
+    arc->OnInsert(Id("hot"), 1, 1);
+    arc->OnAccess(Id("hot")); // T2 へ
+    arc->OnInsert(Id("x"), 1, 1);
+    arc->OnInsert(Id("y"), 1, 1);
+
+    // p = 0：T1（1 回しか使われていない x, y）から先に消す
+    CHECK(Victims(*arc) == std::vector<AssetId>{ Id("x"), Id("y"), Id("hot") });
+
+    // 消した x が B1 の ghost から読み直されると recency 側が広がり（p > 0）、x は T2 に入る
+    arc->OnRemove(Id("x"));
+    CHECK(!arc->Contains(Id("x")));
+    CHECK(arc->Size() == 2);
+    arc->OnInsert(Id("x"), 1, 1);
+    CHECK(arc->Contains(Id("x")));
+    // T1 = {y}（1 件）は p = 1 を超えないので T2 から
+    CHECK(Victims(*arc) == std::vector<AssetId>{ Id("hot"), Id("x"), Id("y") });
+}
+
+TEST_CASE("EvictionSimulator: replays a trace and ranks algorithms by reload bytes") {
+    // 2 つのよく使う asset のあと、1 回しか使わない asset が並ぶ（スキャン）
+    std::vector<Core::EvictionTraceEvent> trace;
+    auto push = [&](const std::string& n) { trace.push_back({ Id(n), 100, 100 }); };
+    for (int i = 0; i < 3; ++i) {
+        push("h1");
+        push("h2");
+    }
+    for (int i = 0; i < 8; ++i) push("cold" + std::to_string(i));
+    push("h1");
+    push("h2");
+
+    Core::EvictionSimulator::Options opt;
+    opt.capacityCount = 3;
+    Core::EvictionSimulator sim(opt);
+
+    auto lru = Core::MakeEvictionStrategy(EvictionAlgorithm::Lru);
+    const auto r = sim.Run(*lru, trace);
+    CHECK(r.accesses == trace.size());
+    CHECK(r.hits == 4);
+    CHECK(r.misses == 12);
+    CHECK(r.missBytes == 1200);
+    CHECK(r.reloadBytes == 200); // スキャンで h1 / h2 が追い出される
+    CHECK(r.evictions == 9);
+    CHECK(r.peakResidentBytes == 300);
+
+    const auto ranked = sim.Compare(trace);
+    REQUIRE(ranked.size() == 4);
+    for (std::size_t i = 1; i < ranked.size(); ++i) {
+        CHECK(ranked[i - 1].second.reloadBytes <= ranked[i].second.reloadBytes);
+    }
+    // 頻度を見る LFU / ARC はスキャンに強い
+    for (const auto& [algo, res] : ranked) {
+        if (algo == EvictionAlgorithm::Lfu || algo == EvictionAlgorithm::Arc) CHECK(res.reloadBytes == 0);
+    }
+    CHECK(ranked.back().second.reloadBytes == 200);
+
+    // バイト容量：大きい 1 件で溢れたら、ほかを消して収める
+    opt.capacityCount = 0;
+    opt.capacityBytes = 250;
+    sim.SetOptions(opt);
+    std::vector<Core::EvictionTraceEvent> big{ { Id("a"), 100, 0 }, { Id("b"), 100, 0 }, { Id("c"), 200, 0 } };
+    const auto rb = sim.Run(*lru, big);
+    CHECK(rb.evictions == 2);
+    CHECK(rb.peakResidentBytes == 200);
+}
@@ -0,0 +1,92 @@
+#include "doctest/doctest.h"
+
+#include "engine/asset/AssetId.hpp"
+#include "engine/asset/AssetRequest.hpp"
+#include "engine/asset/loading/LoadScheduler.hpp"
+
+using Engine::Asset::AssetId;
+using Engine::Asset::AssetRequest;
+using Engine::Asset::Loading::LoadScheduler;
+
+static AssetId Id(const char* s) { return AssetId::FromString(s); }
+
+TEST_CASE("LoadScheduler: higher priority first, FIFO within same priority") {
+    LoadScheduler::Options opt;
+    opt.agingFrames = 0;
+    LoadScheduler q(opt);
+
+    q.Push(Id("bg0"), AssetRequest::AsyncLoad(0), 0);
+    q.Push(Id("bg1"), AssetRequest::AsyncLoad(0), 0);
+    q.Push(Id("hot"), AssetRequest::AsyncLoad(10), 0);
+
+    LoadScheduler::Entry e;
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("hot"));
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("bg0"));
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("bg1"));
+    CHECK(!q.Pop(e));
+}
+
+TEST_CASE("LoadScheduler: re-push raises priority of a queued id") {
+    LoadScheduler::Options opt;
+    opt.agingFrames = 0;
+    LoadScheduler q(opt);
+
+    q.Push(Id("a"), AssetRequest::AsyncLoad(1), 0);
+    q.Push(Id("b"), AssetRequest::AsyncLoad(5), 0);
+
+    // 後から a を高優先度で要求 -> マージされて先頭へ
+    CHECK(q.Push(Id("a"), AssetRequest::AsyncLoad(9), 1) == false);
+    CHECK(q.Size() == 2);
+
+    LoadScheduler::Entry e;
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("a"));
+    CHECK(e.req.priority == 9);
+
+    // 低い priority での再要求は順位を下げない
+    q.Push(Id("b"), AssetRequest::AsyncLoad(0), 2);
+    REQUIRE(q.Pop(e));
+    CHECK(e.req.priority == 5);
+}
+
+TEST_CASE("LoadScheduler: aging lets old low-priority work overtake") {
+    LoadScheduler::Options opt;
+    opt.agingFrames = 10; // 10フレーム待つごとに +1
+    LoadScheduler q(opt);
+
+    q.Push(Id("old"), AssetRequest::AsyncLoad(0), 0);
+    // 25フレーム後に priority 2 が来ても、old は実効 2.5 なので先
+    q.Push(Id("new"), AssetRequest::AsyncLoad(2), 25);
+    // 同フレームに priority 3 なら new3 が先
+    q.Push(Id("new3"), AssetRequest::AsyncLoad(3), 25);
+
+    LoadScheduler::Entry e;
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("new3"));
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("old"));
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("new"));
+}
+
+TEST_CASE("LoadScheduler: restore keeps original order") {
+    LoadScheduler::Options opt;
+    opt.agingFrames = 0;
+    LoadScheduler q(opt);
+
+    q.Push(Id("a"), AssetRequest::AsyncLoad(0), 0);
+    q.Push(Id("b"), AssetRequest::AsyncLoad(0), 0);
+
+    LoadScheduler::Entry e;
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("a"));
+    q.Restore(std::move(e));
+
+    REQUIRE(q.Pop(e));
+    CHECK(e.id == Id("a"));
+    CHECK(q.Erase(Id("b")));
+    CHECK(q.Empty());
+}
@@ -0,0 +1,153 @@
+// AssetPacker：asset_catalog.json に載っているアセットを 1 つの pak にまとめる
+//
+//   AssetPacker <catalog.json> <out.pak> [--root <assetsRoot>] [--compress] [--align <N>]
+//   AssetPacker --compile-catalog <catalog.json> <out.catalog> [--root <assetsRoot>]
+//
+// - resolvedPath は実行時と同じ AssetPathResolver で作る（--root は実行時の assetsRoot と揃えること）
+// - --compress：全エントリを LZ 圧縮する（縮まないものは自動で無圧縮）
+// - --compile-catalog：pak は作らず、catalog をバイナリ形式（AssetCatalog::LoadCompiled 用）にする
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "engine/asset/AssetCatalog.hpp"
+#include "engine/asset/catalog/CatalogCompiler.hpp"
+#include "engine/asset/catalog/CatalogParser.hpp"
+#include "engine/asset/pak/PakBuilder.hpp"
+#include "engine/asset/resolver/AssetPathResolver.hpp"
+#include "engine/asset/sources/FileAssetSource.hpp"
+
+using namespace Engine::Asset;
+
+namespace {
+    void PrintUsage() {
+        std::fprintf(stderr,
+            "usage: AssetPacker <catalog.json> <out.pak> [--root <assetsRoot>] [--compress] [--align <N>]\n"
+            "       AssetPacker --compile-catalog <catalog.json> <out.catalog> [--root <assetsRoot>]\n");
+    }
+
+    void PrintError(const AssetError& e) {
+        std::fprintf(stderr, "error: %s (%s)\n", e.message.c_str(), e.detail.c_str());
+    }
+
+    int CompileCatalog(int argc, char** argv) {
+        if (argc < 4) {
+            PrintUsage();
+            return 2;
+        }
+
+        const std::string catalogPath = argv[2];
+        const std::string outPath = argv[3];
+
+        Resolver::AssetPathResolver::Options ropt;
+        for (int i = 4; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            if (arg == "--root" && i + 1 < argc) {
+                ropt.assetsRoot = argv[++i];
+            } else {
+                PrintUsage();
+                return 2;
+            }
+        }
+
+        Resolver::AssetPathResolver resolver(ropt);
+        Catalog::CatalogParser parser;
+        AssetCatalog catalog;
+
+        auto loaded = catalog.LoadFromFile(catalogPath, parser, resolver);
+        if (!loaded) {
+            PrintError(loaded.error());
+            return 1;
+        }
+
+        Catalog::CatalogCompiler compiler;
+        auto added = compiler.AddCatalog(catalog);
+        if (!added) {
+            PrintError(added.error());
+            return 1;
+        }
+
+        auto written = compiler.WriteToFile(outPath);
+        if (!written) {
+            PrintError(written.error());
+            return 1;
+        }
+
+        std::printf("compiled %zu catalog entries -> %s\n", compiler.EntryCount(), outPath.c_str());
+        return 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 2 && std::string_view(argv[1]) == "--compile-catalog") {
+        return CompileCatalog(argc, argv);
+    }
+
+    if (argc < 3) {
+        PrintUsage();
+        return 2;
+    }
+
+    const std::string catalogPath = argv[1];
+    const std::string outPath = argv[2];
+
+    Resolver::AssetPathResolver::Options ropt;
+    Pak::PakBuilder::Options popt;
+
+    for (int i = 3; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--root" && i + 1 < argc) {
+            ropt.assetsRoot = argv[++i];
+        } else if (arg == "--compress") {
+            popt.compression = Pak::Compression::Lz;
+        } else if (arg == "--align" && i + 1 < argc) {
+            popt.alignment = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    Resolver::AssetPathResolver resolver(ropt);
+    Catalog::CatalogParser parser;
+    AssetCatalog catalog;
+
+    auto loaded = catalog.LoadFromFile(catalogPath, parser, resolver);
+    if (!loaded) {
+        PrintError(loaded.error());
+        return 1;
+    }
+
+    Sources::FileAssetSource files;
+    Pak::PakBuilder builder(popt);
+
+    std::uint64_t rawTotal = 0;
+    for (const auto* e : catalog.Entries()) {
+        auto bytes = files.ReadAll(e->resolvedPath);
+        if (!bytes) {
+            PrintError(bytes.error());
+            return 1;
+        }
+        rawTotal += bytes.value().size();
+
+        auto added = builder.Add(e->id, e->resolvedPath,
+                                 Detail::ConstSpan<std::byte>{ bytes.value().data(), bytes.value().size() });
+        if (!added) {
+            PrintError(added.error());
+            return 1;
+        }
+    }
+
+    auto written = builder.WriteToFile(outPath);
+    if (!written) {
+        PrintError(written.error());
+        return 1;
+    }
+
+    std::printf("packed %zu assets (%llu bytes) -> %s\n",
+                builder.EntryCount(), static_cast<unsigned long long>(rawTotal), outPath.c_str());
+    return 0;
+}